@@ -16,14 +16,22 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #ifdef ENABLE_VALIDITY_CHECK
 #define VALIDITY_CHECK(condition, errorType, message) \
@@ -33,11 +41,37 @@
 #endif
 
 #if defined(__AVX2__)
+// GCC 12 reports spurious -W(maybe-)uninitialized from the inlined _mm512_undefined_* intrinsics.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#else
 #include <immintrin.h>
+#endif
 #elif defined(__ARM_NEON__)
 #include <arm_neon.h>
 #endif
 
+#if defined(__AVX2__) && !defined(INTEGER_DISABLE_AVX512) && (defined(__AVX512F__) || defined(__GNUC__))
+#define INTEGER_AVX512
+#if defined(__AVX512F__)
+#define INTEGER_AVX512_TARGET
+#else
+#define INTEGER_AVX512_TARGET __attribute__((target("avx512f")))
+#endif
+#endif
+
+#ifndef INTEGER_TRANSFORM_LIMIT
+#define INTEGER_TRANSFORM_LIMIT 4194304
+#endif
+
+#ifndef INTEGER_TRANSFORM_BLOCK
+#define INTEGER_TRANSFORM_BLOCK 4096
+#endif
+
 #ifndef __CONSTEXPR
 #ifdef _GLIBCXX14_CONSTEXPR
 #define __CONSTEXPR _GLIBCXX14_CONSTEXPR
@@ -47,6 +81,178 @@
 
 #endif
 
+#ifdef INTEGER_INSTRUMENTATION
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include <atomic>
+#include <chrono>
+
+enum class IntegerAlgorithm : std::uint32_t {
+    BruteforceMultiply,
+    BruteforceSquare,
+    TransformMultiply,
+    ModularTransformMultiply,
+    BruteforceDivision,
+    NewtonDivision,
+    NewtonInverse,
+    DivisionCorrection,
+    TransformResize,
+    ScratchClear,
+    Count
+};
+
+struct IntegerCounter {
+    std::uint64_t calls, limbs, cycles;
+};
+
+struct IntegerStatistics {
+    IntegerCounter algorithms[std::size_t(IntegerAlgorithm::Count)];
+    std::uint64_t allocations, allocatedBytes;
+
+    const IntegerCounter& operator[](IntegerAlgorithm algorithm) const noexcept {
+        return algorithms[std::size_t(algorithm)];
+    }
+
+    static const char* name(IntegerAlgorithm algorithm) noexcept {
+        static const char* const names[] = {"bruteforce_multiply", "bruteforce_square", "transform_multiply", "modular_transform_multiply", "bruteforce_division", "newton_division", "newton_inverse", "division_correction", "transform_resize", "scratch_clear"};
+        return algorithm < IntegerAlgorithm::Count ? names[std::size_t(algorithm)] : "unknown";
+    }
+
+    template <typename Callback>
+    void forEach(Callback&& callback) const {
+        for (std::uint32_t i = 0; i != std::uint32_t(IntegerAlgorithm::Count); ++i)
+            callback(name(IntegerAlgorithm(i)), algorithms[i]);
+    }
+
+    static IntegerStatistics thread() noexcept;
+
+    static IntegerStatistics total();
+
+    static void resetThread() noexcept;
+};
+
+namespace detail {
+    // Counters are written only by their owning thread (plain load/store, no locked RMW) and read by total() from any thread.
+    struct ProfileCounters {
+        static constexpr std::uint32_t Size = std::uint32_t(IntegerAlgorithm::Count) * 3 + 2;
+
+        std::atomic<std::uint64_t> values[Size];
+
+        ProfileCounters() noexcept;
+
+        ~ProfileCounters() noexcept;
+
+        void add(std::uint32_t index, std::uint64_t amount) noexcept {
+            values[index].store(values[index].load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        static IntegerStatistics unpack(const std::uint64_t* sums) noexcept {
+            IntegerStatistics result;
+            for (std::uint32_t i = 0; i != std::uint32_t(IntegerAlgorithm::Count); ++i)
+                result.algorithms[i] = {sums[i * 3], sums[i * 3 + 1], sums[i * 3 + 2]};
+            return result.allocations = sums[Size - 2], result.allocatedBytes = sums[Size - 1], result;
+        }
+
+        void accumulate(std::uint64_t* sums) const noexcept {
+            for (std::uint32_t i = 0; i != Size; ++i)
+                sums[i] += values[i].load(std::memory_order_relaxed);
+        }
+    };
+
+    struct ProfileRegistry {
+        std::mutex mutex;
+        std::vector<ProfileCounters*> live;
+        std::uint64_t retired[ProfileCounters::Size] = {};
+
+        static ProfileRegistry& instance() {
+            static ProfileRegistry registry;
+            return registry;
+        }
+    };
+
+    inline ProfileCounters::ProfileCounters() noexcept : values() {
+        ProfileRegistry& registry = ProfileRegistry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.live.push_back(this);
+    }
+
+    inline ProfileCounters::~ProfileCounters() noexcept {
+        ProfileRegistry& registry = ProfileRegistry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        accumulate(registry.retired), registry.live.erase(std::find(registry.live.begin(), registry.live.end(), this));
+    }
+
+    inline ProfileCounters& profileCounters() noexcept {
+        thread_local ProfileCounters counters;
+        return counters;
+    }
+
+    inline std::uint64_t profileClock() noexcept {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    class ProfileScope {
+        std::uint32_t index;
+        std::uint64_t start;
+
+      public:
+        ProfileScope(IntegerAlgorithm algorithm, std::uint64_t limbs) noexcept : index(std::uint32_t(algorithm) * 3), start(profileClock()) {
+            ProfileCounters& counters = profileCounters();
+            counters.add(index, 1), counters.add(index + 1, limbs);
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+        ~ProfileScope() noexcept {
+            profileCounters().add(index + 2, profileClock() - start);
+        }
+    };
+
+    inline void profileAllocation(std::uint64_t bytes) noexcept {
+        ProfileCounters& counters = profileCounters();
+        counters.add(ProfileCounters::Size - 2, 1), counters.add(ProfileCounters::Size - 1, bytes);
+    }
+} // namespace detail
+
+inline IntegerStatistics IntegerStatistics::thread() noexcept {
+    std::uint64_t sums[detail::ProfileCounters::Size] = {};
+    detail::profileCounters().accumulate(sums);
+    return detail::ProfileCounters::unpack(sums);
+}
+
+inline IntegerStatistics IntegerStatistics::total() {
+    detail::ProfileRegistry& registry = detail::ProfileRegistry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::uint64_t sums[detail::ProfileCounters::Size];
+    std::copy(registry.retired, registry.retired + detail::ProfileCounters::Size, sums);
+    for (const detail::ProfileCounters* counters : registry.live)
+        counters->accumulate(sums);
+    return detail::ProfileCounters::unpack(sums);
+}
+
+inline void IntegerStatistics::resetThread() noexcept {
+    for (std::atomic<std::uint64_t>& value : detail::profileCounters().values)
+        value.store(0, std::memory_order_relaxed);
+}
+
+#define INTEGER_PROFILE_CONCAT_(name, line) name##line
+#define INTEGER_PROFILE_CONCAT(name, line) INTEGER_PROFILE_CONCAT_(name, line)
+#define INTEGER_PROFILE(algorithm, limbs) const detail::ProfileScope INTEGER_PROFILE_CONCAT(integerProfileScope, __LINE__)(IntegerAlgorithm::algorithm, limbs)
+#define INTEGER_PROFILE_ALLOCATION(bytes) detail::profileAllocation(bytes)
+#else
+#define INTEGER_PROFILE(algorithm, limbs)
+#define INTEGER_PROFILE_ALLOCATION(bytes)
+#endif
+
 namespace detail {
     constexpr std::uint32_t log2(std::uint32_t n) {
         VALIDITY_CHECK(n, std::invalid_argument, "log2 error: the provided integer is zero.");
@@ -57,6 +263,130 @@ namespace detail {
 #endif
     }
 
+    template <typename integral>
+    constexpr bool isNegative(integral value) {
+        return std::is_signed<integral>::value && value < integral();
+    }
+
+    template <typename integral>
+    constexpr std::uint64_t magnitude(integral value) {
+        return isNegative(value) ? std::uint64_t(0) - std::uint64_t(value) : std::uint64_t(value);
+    }
+
+    template <typename Helper, std::uint32_t Ways = 1>
+    class SharedTwiddleTable {
+        using Factor = typename Helper::Factor;
+
+        struct Generation {
+            Generation* previous;
+            Factor* factors;
+        };
+
+        std::mutex mutex;
+        Generation* latest;
+        std::uint32_t length;
+
+      public:
+        explicit SharedTwiddleTable(const Factor* initialFactors) : latest(new Generation{nullptr, new Factor[Ways]}), length(1) {
+            std::copy(initialFactors, initialFactors + Ways, latest->factors);
+        }
+
+        SharedTwiddleTable(const SharedTwiddleTable&) = delete;
+
+        SharedTwiddleTable& operator=(const SharedTwiddleTable&) = delete;
+
+        ~SharedTwiddleTable() noexcept {
+            for (Generation* previous; latest; latest = previous)
+                previous = latest->previous, delete[] latest->factors, delete latest;
+        }
+
+        template <typename Grow>
+        const Factor* acquire(std::uint32_t requiredLength, Grow grow, std::uint32_t& acquiredLength) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (length < requiredLength) {
+                Generation* generation = new Generation{latest, new Factor[std::size_t(requiredLength) * Ways]};
+                for (std::uint32_t way = 0; way != Ways; ++way)
+                    std::copy(latest->factors + std::size_t(way) * length, latest->factors + std::size_t(way + 1) * length, generation->factors + std::size_t(way) * requiredLength);
+                grow(generation->factors, length, requiredLength);
+                latest = generation, length = requiredLength;
+            }
+            return acquiredLength = length, latest->factors;
+        }
+    };
+
+    struct ScratchBuffer {
+        void* data;
+        std::uint32_t size;
+
+        ScratchBuffer() : data(nullptr), size(0) {}
+
+        ScratchBuffer(const ScratchBuffer&) = delete;
+
+        ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+        ~ScratchBuffer() noexcept {
+            ::operator delete(data);
+        }
+
+        template <typename Element>
+        Element* reserve(std::uint32_t requiredSize) {
+            if (size < requiredSize) {
+                INTEGER_PROFILE_ALLOCATION(std::size_t(requiredSize) * sizeof(Element));
+                ::operator delete(data), data = nullptr, size = 0, data = ::operator new(std::size_t(requiredSize) * sizeof(Element)), size = requiredSize;
+            }
+            return static_cast<Element*>(data);
+        }
+
+        void release(std::uint32_t keepSize) noexcept {
+            if (size > keepSize)
+                ::operator delete(data), data = nullptr, size = 0;
+        }
+    };
+
+    template <typename Helper, typename Element>
+    void blockedDecimationInFrequency(const Helper& helper, Element* dataArray, std::uint32_t transformSize, std::uint32_t firstBlock) {
+        std::uint32_t stepSize = transformSize;
+        if (log2(transformSize) & 1)
+            helper.forwardButterflies(dataArray, stepSize >> 1, stepSize >> 1, firstBlock), stepSize >>= 1;
+        for (; stepSize > INTEGER_TRANSFORM_BLOCK; stepSize >>= 2)
+            for (std::uint32_t blockIndex = 0; blockIndex != transformSize / stepSize; ++blockIndex)
+                helper.forwardQuadButterflies(dataArray + blockIndex * stepSize, stepSize >> 2, stepSize >> 2, firstBlock * (transformSize / stepSize) + blockIndex);
+        for (std::uint32_t blockIndex = 0; blockIndex != transformSize / stepSize; ++blockIndex)
+            for (std::uint32_t localStep = stepSize; localStep != 1; localStep >>= 2)
+                for (std::uint32_t localIndex = 0; localIndex != stepSize / localStep; ++localIndex)
+                    helper.forwardQuadButterflies(dataArray + blockIndex * stepSize + localIndex * localStep, localStep >> 2, localStep >> 2, (firstBlock * (transformSize / stepSize) + blockIndex) * (stepSize / localStep) + localIndex);
+    }
+
+    template <typename Helper, typename Element>
+    void blockedDecimationInTime(const Helper& helper, Element* dataArray, std::uint32_t transformSize, std::uint32_t firstBlock) {
+        const std::uint32_t quadSize = transformSize >> (log2(transformSize) & 1);
+        std::uint32_t stepSize = quadSize;
+        for (; stepSize > INTEGER_TRANSFORM_BLOCK; stepSize >>= 2);
+        for (std::uint32_t blockIndex = 0; blockIndex != transformSize / stepSize; ++blockIndex)
+            for (std::uint32_t localStep = 4; localStep <= stepSize; localStep <<= 2)
+                for (std::uint32_t localIndex = 0; localIndex != stepSize / localStep; ++localIndex)
+                    helper.inverseQuadButterflies(dataArray + blockIndex * stepSize + localIndex * localStep, localStep >> 2, localStep >> 2, (firstBlock * (transformSize / stepSize) + blockIndex) * (stepSize / localStep) + localIndex);
+        for (stepSize <<= 2; stepSize <= quadSize; stepSize <<= 2)
+            for (std::uint32_t blockIndex = 0; blockIndex != transformSize / stepSize; ++blockIndex)
+                helper.inverseQuadButterflies(dataArray + blockIndex * stepSize, stepSize >> 2, stepSize >> 2, firstBlock * (transformSize / stepSize) + blockIndex);
+        if (quadSize != transformSize)
+            helper.inverseButterflies(dataArray, quadSize, quadSize, firstBlock);
+    }
+
+    struct StreamWindow : std::streambuf {
+        static const char* begin(std::streambuf* buffer) {
+            return (buffer->*&StreamWindow::gptr)();
+        }
+
+        static const char* end(std::streambuf* buffer) {
+            return (buffer->*&StreamWindow::egptr)();
+        }
+
+        static void advance(std::streambuf* buffer, std::ptrdiff_t count) {
+            (buffer->*&StreamWindow::gbump)(int(count));
+        }
+    };
+
     struct InputHelper {
         std::uint32_t table[0x10000];
 
@@ -91,16 +421,90 @@ namespace detail {
 
 #if defined(__AVX2__)
     struct TransformHelper {
-        __m128d* twiddleFactors;
+        using Complex = __m128d;
+        using Factor = Complex;
+
+        const __m128d* twiddleFactors;
         std::uint32_t length;
+#ifdef INTEGER_AVX512
+        bool wideVectors;
+#endif
+
+        TransformHelper() : twiddleFactors(nullptr), length(0) {
+#ifdef INTEGER_AVX512
+            wideVectors = supportsWideVectors();
+#endif
+            resize(2);
+        }
+
+        static SharedTwiddleTable<TransformHelper>& sharedTwiddles() {
+            static const Factor unitFactor = _mm_set_pd(0.0, 1.0);
+            static SharedTwiddleTable<TransformHelper> table(&unitFactor);
+            return table;
+        }
+
+#ifdef INTEGER_AVX512
+        static bool supportsWideVectors() {
+#if defined(__AVX512F__)
+            return true;
+#else
+            return __builtin_cpu_supports("avx512f");
+#endif
+        }
+
+        INTEGER_AVX512_TARGET static inline __m512d broadcastComplex(__m128d value) {
+            return _mm512_castps_pd(_mm512_broadcast_f32x4(_mm_castpd_ps(value)));
+        }
+
+        INTEGER_AVX512_TARGET static inline __m512d complexMultiply(__m512d first, __m512d second) {
+            return _mm512_fmaddsub_pd(_mm512_unpacklo_pd(first, first), second, _mm512_mul_pd(_mm512_unpackhi_pd(first, first), _mm512_permute_pd(second, 0x55)));
+        }
+
+        INTEGER_AVX512_TARGET static inline __m512d complexMultiplyConjugate(__m512d first, __m512d second) {
+            return _mm512_fmsubadd_pd(_mm512_unpacklo_pd(second, second), first, _mm512_mul_pd(_mm512_unpackhi_pd(second, second), _mm512_permute_pd(first, 0x55)));
+        }
+
+        INTEGER_AVX512_TARGET void wideForwardButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+            const __m512d twiddle = broadcastComplex(twiddleFactors[blockIndex]);
+            for (__m128d* currentElement = blockStart; currentElement != blockStart + count; currentElement += 4) {
+                const __m512d evenElement = _mm512_loadu_pd(currentElement), oddElement = blockIndex ? complexMultiply(_mm512_loadu_pd(currentElement + blockSize), twiddle) : _mm512_loadu_pd(currentElement + blockSize);
+                _mm512_storeu_pd(currentElement, _mm512_add_pd(evenElement, oddElement)), _mm512_storeu_pd(currentElement + blockSize, _mm512_sub_pd(evenElement, oddElement));
+            }
+        }
 
-        TransformHelper() : twiddleFactors(new __m128d[1]()), length(1) {
-            *twiddleFactors = _mm_set_pd(0.0, 1.0);
+        INTEGER_AVX512_TARGET void wideInverseButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+            const __m512d twiddle = broadcastComplex(twiddleFactors[blockIndex]);
+            for (__m128d* currentElement = blockStart; currentElement != blockStart + count; currentElement += 4) {
+                const __m512d evenElement = _mm512_loadu_pd(currentElement), oddElement = _mm512_loadu_pd(currentElement + blockSize), difference = _mm512_sub_pd(evenElement, oddElement);
+                _mm512_storeu_pd(currentElement, _mm512_add_pd(evenElement, oddElement)), _mm512_storeu_pd(currentElement + blockSize, blockIndex ? complexMultiplyConjugate(difference, twiddle) : difference);
+            }
+        }
+
+        INTEGER_AVX512_TARGET void wideForwardQuadButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+            const __m512d outerTwiddle = broadcastComplex(twiddleFactors[blockIndex]), evenTwiddle = broadcastComplex(twiddleFactors[blockIndex << 1]), oddTwiddle = broadcastComplex(twiddleFactors[blockIndex << 1 | 1]);
+            for (__m128d* currentElement = blockStart; currentElement != blockStart + count; currentElement += 4) {
+                const __m512d firstElement = _mm512_loadu_pd(currentElement), secondElement = _mm512_loadu_pd(currentElement + quarterSize);
+                const __m512d thirdElement = blockIndex ? complexMultiply(_mm512_loadu_pd(currentElement + (quarterSize << 1)), outerTwiddle) : _mm512_loadu_pd(currentElement + (quarterSize << 1));
+                const __m512d fourthElement = blockIndex ? complexMultiply(_mm512_loadu_pd(currentElement + quarterSize * 3), outerTwiddle) : _mm512_loadu_pd(currentElement + quarterSize * 3);
+                const __m512d upperEven = _mm512_add_pd(firstElement, thirdElement), lowerEven = _mm512_sub_pd(firstElement, thirdElement);
+                const __m512d upperOdd = blockIndex ? complexMultiply(_mm512_add_pd(secondElement, fourthElement), evenTwiddle) : _mm512_add_pd(secondElement, fourthElement), lowerOdd = complexMultiply(_mm512_sub_pd(secondElement, fourthElement), oddTwiddle);
+                _mm512_storeu_pd(currentElement, _mm512_add_pd(upperEven, upperOdd)), _mm512_storeu_pd(currentElement + quarterSize, _mm512_sub_pd(upperEven, upperOdd));
+                _mm512_storeu_pd(currentElement + (quarterSize << 1), _mm512_add_pd(lowerEven, lowerOdd)), _mm512_storeu_pd(currentElement + quarterSize * 3, _mm512_sub_pd(lowerEven, lowerOdd));
+            }
         }
 
-        ~TransformHelper() noexcept {
-            delete[] twiddleFactors;
+        INTEGER_AVX512_TARGET void wideInverseQuadButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+            const __m512d outerTwiddle = broadcastComplex(twiddleFactors[blockIndex]), evenTwiddle = broadcastComplex(twiddleFactors[blockIndex << 1]), oddTwiddle = broadcastComplex(twiddleFactors[blockIndex << 1 | 1]);
+            for (__m128d* currentElement = blockStart; currentElement != blockStart + count; currentElement += 4) {
+                const __m512d firstElement = _mm512_loadu_pd(currentElement), secondElement = _mm512_loadu_pd(currentElement + quarterSize), thirdElement = _mm512_loadu_pd(currentElement + (quarterSize << 1)), fourthElement = _mm512_loadu_pd(currentElement + quarterSize * 3);
+                const __m512d upperSum = _mm512_add_pd(firstElement, secondElement), upperDifference = blockIndex ? complexMultiplyConjugate(_mm512_sub_pd(firstElement, secondElement), evenTwiddle) : _mm512_sub_pd(firstElement, secondElement);
+                const __m512d lowerSum = _mm512_add_pd(thirdElement, fourthElement), lowerDifference = complexMultiplyConjugate(_mm512_sub_pd(thirdElement, fourthElement), oddTwiddle);
+                _mm512_storeu_pd(currentElement, _mm512_add_pd(upperSum, lowerSum)), _mm512_storeu_pd(currentElement + quarterSize, _mm512_add_pd(upperDifference, lowerDifference));
+                _mm512_storeu_pd(currentElement + (quarterSize << 1), blockIndex ? complexMultiplyConjugate(_mm512_sub_pd(upperSum, lowerSum), outerTwiddle) : _mm512_sub_pd(upperSum, lowerSum));
+                _mm512_storeu_pd(currentElement + quarterSize * 3, blockIndex ? complexMultiplyConjugate(_mm512_sub_pd(upperDifference, lowerDifference), outerTwiddle) : _mm512_sub_pd(upperDifference, lowerDifference));
+            }
         }
+#endif
 
         static inline __m128d complexMultiply(__m128d first, __m128d second) {
             return _mm_fmaddsub_pd(_mm_unpacklo_pd(first, first), second, _mm_unpackhi_pd(first, first) * _mm_permute_pd(second, 1));
@@ -118,61 +522,115 @@ namespace detail {
             return complex * _mm_set1_pd(scalar);
         }
 
+        static inline __m128d splitDigit(std::uint32_t digit) {
+            return _mm_set_pd(static_cast<double>(digit / 10000u), static_cast<double>(digit % 10000u));
+        }
+
+        static inline std::uint64_t mergeDigit(__m128d value) {
+            return std::uint64_t(std::int64_t(_mm_cvtsd_f64(value) + 0.5) + std::int64_t(_mm_cvtsd_f64(_mm_unpackhi_pd(value, value)) + 0.5) * 10000);
+        }
+
+        static void growTwiddles(__m128d* factors, std::uint32_t oldLength, std::uint32_t newLength) {
+            std::uint32_t halfLog = detail::log2(newLength << 1) >> 1, halfSize = 1 << halfLog;
+            __m128d* baseFactors = new __m128d[halfSize << 1]();
+            const double angleStep = std::acos(-1.0) / halfSize, fineAngleStep = angleStep / halfSize;
+            for (std::uint32_t i = 0, j = (halfSize * 3) >> 1, phaseAccumulator = 0; i != halfSize; phaseAccumulator -= halfSize - (j >> __builtin_ctz(++i))) {
+                std::complex<double> first = std::polar(1.0, phaseAccumulator * angleStep), second = std::polar(1.0, phaseAccumulator * fineAngleStep);
+                baseFactors[i] = _mm_set_pd(first.imag(), first.real()), baseFactors[i | halfSize] = _mm_set_pd(second.imag(), second.real());
+            }
+            for (std::uint32_t i = oldLength; i != newLength; ++i)
+                factors[i] = complexMultiply(baseFactors[i & (halfSize - 1)], baseFactors[halfSize | (i >> halfLog)]);
+            delete[] baseFactors;
+        }
+
         void resize(std::uint32_t transformLength) {
             if (transformLength > length << 1) {
-                std::uint32_t halfLog = detail::log2(transformLength) >> 1, halfSize = 1 << halfLog;
-                __m128d* baseFactors = new __m128d[halfSize << 1]();
-                const double angleStep = std::acos(-1.0) / halfSize, fineAngleStep = angleStep / halfSize;
-                for (std::uint32_t i = 0, j = (halfSize * 3) >> 1, phaseAccumulator = 0; i != halfSize; phaseAccumulator -= halfSize - (j >> __builtin_ctz(++i))) {
-                    std::complex<double> first = std::polar(1.0, phaseAccumulator * angleStep), second = std::polar(1.0, phaseAccumulator * fineAngleStep);
-                    baseFactors[i] = _mm_set_pd(first.imag(), first.real()), baseFactors[i | halfSize] = _mm_set_pd(second.imag(), second.real());
-                }
-                __m128d* newFactors = reinterpret_cast<__m128d*>(std::memcpy(new __m128d[transformLength >> 1], twiddleFactors, length << 4));
-                delete[] twiddleFactors, twiddleFactors = newFactors;
-                for (std::uint32_t i = length; i != transformLength >> 1; ++i)
-                    twiddleFactors[i] = complexMultiply(baseFactors[i & (halfSize - 1)], baseFactors[halfSize | (i >> halfLog)]);
-                delete[] baseFactors, length = transformLength >> 1;
+                INTEGER_PROFILE(TransformResize, transformLength);
+                twiddleFactors = sharedTwiddles().acquire(transformLength >> 1, growTwiddles, length);
             }
         }
 
-        void decimationInFrequency(__m128d* dataArray, std::uint32_t transformSize) {
-            for (std::uint32_t blockSize = transformSize >> 1, stepSize = transformSize; blockSize; stepSize = blockSize, blockSize >>= 1) {
-                for (__m128d* currentElement = dataArray; currentElement != dataArray + blockSize; ++currentElement) {
+        void forwardButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+#ifdef INTEGER_AVX512
+            if (wideVectors && count >= 4)
+                return wideForwardButterflies(blockStart, count, blockSize, blockIndex);
+#endif
+            if (!blockIndex)
+                for (__m128d* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
                     const __m128d evenElement = *currentElement, oddElement = currentElement[blockSize];
                     *currentElement = evenElement + oddElement, currentElement[blockSize] = evenElement - oddElement;
                 }
-                for (__m128d *blockStart = dataArray + stepSize, *twiddlePointer = twiddleFactors + 1; blockStart != dataArray + transformSize; blockStart += stepSize, ++twiddlePointer) {
-                    for (__m128d* currentElement = blockStart; currentElement != blockStart + blockSize; ++currentElement) {
-                        const __m128d evenElement = *currentElement, oddElement = complexMultiply(currentElement[blockSize], *twiddlePointer);
-                        *currentElement = evenElement + oddElement, currentElement[blockSize] = evenElement - oddElement;
-                    }
+            else
+                for (__m128d *currentElement = blockStart, twiddle = twiddleFactors[blockIndex]; currentElement != blockStart + count; ++currentElement) {
+                    const __m128d evenElement = *currentElement, oddElement = complexMultiply(currentElement[blockSize], twiddle);
+                    *currentElement = evenElement + oddElement, currentElement[blockSize] = evenElement - oddElement;
                 }
-            }
         }
 
-        void decimationInTime(__m128d* dataArray, std::uint32_t transformSize) {
-            for (std::uint32_t blockSize = 1, stepSize = 2; blockSize != transformSize; blockSize = stepSize, stepSize <<= 1) {
-                for (__m128d* currentElement = dataArray; currentElement != dataArray + blockSize; ++currentElement) {
+        void inverseButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+#ifdef INTEGER_AVX512
+            if (wideVectors && count >= 4)
+                return wideInverseButterflies(blockStart, count, blockSize, blockIndex);
+#endif
+            if (!blockIndex)
+                for (__m128d* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
                     const __m128d evenElement = *currentElement, oddElement = currentElement[blockSize];
                     *currentElement = evenElement + oddElement, currentElement[blockSize] = evenElement - oddElement;
                 }
-                for (__m128d *blockStart = dataArray + stepSize, *twiddlePointer = twiddleFactors + 1; blockStart != dataArray + transformSize; blockStart += stepSize, ++twiddlePointer) {
-                    for (__m128d* currentElement = blockStart; currentElement != blockStart + blockSize; ++currentElement) {
-                        const __m128d evenElement = *currentElement, oddElement = currentElement[blockSize];
-                        *currentElement = evenElement + oddElement, currentElement[blockSize] = complexMultiplyConjugate(evenElement - oddElement, *twiddlePointer);
-                    }
+            else
+                for (__m128d *currentElement = blockStart, twiddle = twiddleFactors[blockIndex]; currentElement != blockStart + count; ++currentElement) {
+                    const __m128d evenElement = *currentElement, oddElement = currentElement[blockSize];
+                    *currentElement = evenElement + oddElement, currentElement[blockSize] = complexMultiplyConjugate(evenElement - oddElement, twiddle);
                 }
+        }
+
+        void forwardQuadButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+#ifdef INTEGER_AVX512
+            if (wideVectors && count >= 4)
+                return wideForwardQuadButterflies(blockStart, count, quarterSize, blockIndex);
+#endif
+            const __m128d outerTwiddle = twiddleFactors[blockIndex], evenTwiddle = twiddleFactors[blockIndex << 1], oddTwiddle = twiddleFactors[blockIndex << 1 | 1];
+            for (__m128d* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
+                const __m128d firstElement = currentElement[0], secondElement = currentElement[quarterSize];
+                const __m128d thirdElement = blockIndex ? complexMultiply(currentElement[quarterSize << 1], outerTwiddle) : currentElement[quarterSize << 1];
+                const __m128d fourthElement = blockIndex ? complexMultiply(currentElement[quarterSize * 3], outerTwiddle) : currentElement[quarterSize * 3];
+                const __m128d upperEven = firstElement + thirdElement, lowerEven = firstElement - thirdElement;
+                const __m128d upperOdd = blockIndex ? complexMultiply(secondElement + fourthElement, evenTwiddle) : secondElement + fourthElement, lowerOdd = complexMultiply(secondElement - fourthElement, oddTwiddle);
+                currentElement[0] = upperEven + upperOdd, currentElement[quarterSize] = upperEven - upperOdd;
+                currentElement[quarterSize << 1] = lowerEven + lowerOdd, currentElement[quarterSize * 3] = lowerEven - lowerOdd;
             }
         }
 
-        void frequencyDomainPointwiseMultiply(__m128d* firstArray, __m128d* secondArray, std::uint32_t transformSize) {
-            const double normalizationFactor = 1.0 / transformSize, scalingFactor = normalizationFactor * 0.25;
-            firstArray[0] = complexScalarMultiply(complexMultiplySpecial(firstArray[0], secondArray[0]), normalizationFactor);
-            firstArray[1] = complexScalarMultiply(complexMultiply(firstArray[1], secondArray[1]), normalizationFactor);
+        void inverseQuadButterflies(__m128d* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+#ifdef INTEGER_AVX512
+            if (wideVectors && count >= 4)
+                return wideInverseQuadButterflies(blockStart, count, quarterSize, blockIndex);
+#endif
+            const __m128d outerTwiddle = twiddleFactors[blockIndex], evenTwiddle = twiddleFactors[blockIndex << 1], oddTwiddle = twiddleFactors[blockIndex << 1 | 1];
+            for (__m128d* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
+                const __m128d firstElement = currentElement[0], secondElement = currentElement[quarterSize], thirdElement = currentElement[quarterSize << 1], fourthElement = currentElement[quarterSize * 3];
+                const __m128d upperSum = firstElement + secondElement, upperDifference = blockIndex ? complexMultiplyConjugate(firstElement - secondElement, evenTwiddle) : firstElement - secondElement;
+                const __m128d lowerSum = thirdElement + fourthElement, lowerDifference = complexMultiplyConjugate(thirdElement - fourthElement, oddTwiddle);
+                currentElement[0] = upperSum + lowerSum, currentElement[quarterSize] = upperDifference + lowerDifference;
+                currentElement[quarterSize << 1] = blockIndex ? complexMultiplyConjugate(upperSum - lowerSum, outerTwiddle) : upperSum - lowerSum;
+                currentElement[quarterSize * 3] = blockIndex ? complexMultiplyConjugate(upperDifference - lowerDifference, outerTwiddle) : upperDifference - lowerDifference;
+            }
+        }
+
+        void decimationInFrequency(__m128d* dataArray, std::uint32_t transformSize) const {
+            blockedDecimationInFrequency(*this, dataArray, transformSize, 0);
+        }
+
+        void decimationInTime(__m128d* dataArray, std::uint32_t transformSize) const {
+            blockedDecimationInTime(*this, dataArray, transformSize, 0);
+        }
+
+        void pointwiseMultiply(__m128d* firstArray, const __m128d* secondArray, std::uint32_t transformSize, std::uint32_t pairBegin, std::uint32_t pairEnd) const {
+            const double scalingFactor = 0.25 / transformSize;
             const __m128d conjugateMask = _mm_castsi128_pd(_mm_set_epi64x(std::int64_t(1ull << 63), 0));
             const __m128d negateMask = _mm_castsi128_pd(_mm_set_epi64x(std::int64_t(1ull << 63), std::int64_t(1ull << 63)));
-            for (std::uint32_t blockStart = 2, blockEnd = 3; blockStart != transformSize; blockStart <<= 1, blockEnd <<= 1) {
-                for (std::uint32_t forwardIndex = blockStart, backwardIndex = forwardIndex + blockStart - 1; forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
+            for (std::uint32_t blockStart = 2u << detail::log2(pairBegin); pairBegin != pairEnd; pairBegin = std::min(pairEnd, blockStart), blockStart <<= 1) {
+                for (std::uint32_t forwardIndex = pairBegin + (blockStart >> 1), backwardIndex = 3 * blockStart - 1 - forwardIndex, blockEnd = std::min(pairEnd, blockStart) + (blockStart >> 1); forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
                     const __m128d firstEven = _mm_add_pd(firstArray[forwardIndex], _mm_xor_pd(firstArray[backwardIndex], conjugateMask)), firstOdd = _mm_sub_pd(firstArray[forwardIndex], _mm_xor_pd(firstArray[backwardIndex], conjugateMask));
                     const __m128d secondEven = _mm_add_pd(secondArray[forwardIndex], _mm_xor_pd(secondArray[backwardIndex], conjugateMask)), secondOdd = _mm_sub_pd(secondArray[forwardIndex], _mm_xor_pd(secondArray[backwardIndex], conjugateMask));
                     const __m128d productA = _mm_sub_pd(complexMultiply(firstEven, secondEven), complexMultiply(complexMultiply(firstOdd, secondOdd), (forwardIndex & 1 ? _mm_xor_pd(twiddleFactors[forwardIndex >> 1], negateMask) : twiddleFactors[forwardIndex >> 1]))), productB = _mm_add_pd(complexMultiply(secondEven, firstOdd), complexMultiply(firstEven, secondOdd));
@@ -181,18 +639,52 @@ namespace detail {
                 }
             }
         }
+
+        void pointwiseSquare(__m128d* dataArray, std::uint32_t transformSize, std::uint32_t pairBegin, std::uint32_t pairEnd) const {
+            const double scalingFactor = 0.25 / transformSize;
+            const __m128d conjugateMask = _mm_castsi128_pd(_mm_set_epi64x(std::int64_t(1ull << 63), 0));
+            const __m128d negateMask = _mm_castsi128_pd(_mm_set_epi64x(std::int64_t(1ull << 63), std::int64_t(1ull << 63)));
+            for (std::uint32_t blockStart = 2u << detail::log2(pairBegin); pairBegin != pairEnd; pairBegin = std::min(pairEnd, blockStart), blockStart <<= 1) {
+                for (std::uint32_t forwardIndex = pairBegin + (blockStart >> 1), backwardIndex = 3 * blockStart - 1 - forwardIndex, blockEnd = std::min(pairEnd, blockStart) + (blockStart >> 1); forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
+                    const __m128d evenPart = _mm_add_pd(dataArray[forwardIndex], _mm_xor_pd(dataArray[backwardIndex], conjugateMask)), oddPart = _mm_sub_pd(dataArray[forwardIndex], _mm_xor_pd(dataArray[backwardIndex], conjugateMask));
+                    const __m128d crossProduct = complexMultiply(evenPart, oddPart);
+                    const __m128d productA = _mm_sub_pd(complexMultiply(evenPart, evenPart), complexMultiply(complexMultiply(oddPart, oddPart), (forwardIndex & 1 ? _mm_xor_pd(twiddleFactors[forwardIndex >> 1], negateMask) : twiddleFactors[forwardIndex >> 1]))), productB = _mm_add_pd(crossProduct, crossProduct);
+                    dataArray[forwardIndex] = complexScalarMultiply(_mm_add_pd(productA, productB), scalingFactor);
+                    dataArray[backwardIndex] = _mm_xor_pd(complexScalarMultiply(_mm_sub_pd(productA, productB), scalingFactor), conjugateMask);
+                }
+            }
+        }
+
+        void pointwiseEndpoints(__m128d* firstArray, const __m128d* secondArray, std::uint32_t transformSize) const {
+            const double normalizationFactor = 1.0 / transformSize;
+            firstArray[0] = complexScalarMultiply(complexMultiplySpecial(firstArray[0], secondArray[0]), normalizationFactor);
+            firstArray[1] = complexScalarMultiply(complexMultiply(firstArray[1], secondArray[1]), normalizationFactor);
+        }
+
+        void frequencyDomainPointwiseMultiply(__m128d* firstArray, const __m128d* secondArray, std::uint32_t transformSize) {
+            pointwiseEndpoints(firstArray, secondArray, transformSize), pointwiseMultiply(firstArray, secondArray, transformSize, 1, transformSize >> 1);
+        }
+
+        void frequencyDomainPointwiseSquare(__m128d* dataArray, std::uint32_t transformSize) {
+            pointwiseEndpoints(dataArray, dataArray, transformSize), pointwiseSquare(dataArray, transformSize, 1, transformSize >> 1);
+        }
     };
 #elif defined(__ARM_NEON__)
     struct TransformHelper {
-        float64x2_t* twiddleFactors;
+        using Complex = float64x2_t;
+        using Factor = Complex;
+
+        const float64x2_t* twiddleFactors;
         std::uint32_t length;
 
-        TransformHelper() : twiddleFactors(new float64x2_t[1]()), length(1) {
-            *twiddleFactors = vsetq_lane_f64(0.0, vsetq_lane_f64(1.0, vdupq_n_f64(0.0), 0), 1);
+        TransformHelper() : twiddleFactors(nullptr), length(0) {
+            resize(2);
         }
 
-        ~TransformHelper() noexcept {
-            delete[] twiddleFactors;
+        static SharedTwiddleTable<TransformHelper>& sharedTwiddles() {
+            static const Factor unitFactor = vsetq_lane_f64(0.0, vsetq_lane_f64(1.0, vdupq_n_f64(0.0), 0), 1);
+            static SharedTwiddleTable<TransformHelper> table(&unitFactor);
+            return table;
         }
 
         static inline float64x2_t complexMultiply(float64x2_t first, float64x2_t second) {
@@ -221,70 +713,105 @@ namespace detail {
             return vmulq_n_f64(complex, scalar);
         }
 
+        static inline float64x2_t splitDigit(std::uint32_t digit) {
+            return vsetq_lane_f64(static_cast<double>(digit / 10000u), vsetq_lane_f64(static_cast<double>(digit % 10000u), vdupq_n_f64(0.0), 0), 1);
+        }
+
+        static inline std::uint64_t mergeDigit(float64x2_t value) {
+            return std::uint64_t(std::int64_t(vgetq_lane_f64(value, 0) + 0.5) + std::int64_t(vgetq_lane_f64(value, 1) + 0.5) * 10000);
+        }
+
+        static void growTwiddles(float64x2_t* factors, std::uint32_t oldLength, std::uint32_t newLength) {
+            std::uint32_t halfLog = detail::log2(newLength << 1) >> 1, halfSize = 1 << halfLog;
+            float64x2_t* baseFactors = new float64x2_t[halfSize << 1]();
+            const double angleStep = std::acos(-1.0) / halfSize, fineAngleStep = angleStep / halfSize;
+            for (std::uint32_t i = 0, j = (halfSize * 3) >> 1, phaseAccumulator = 0; i != halfSize; phaseAccumulator -= halfSize - (j >> __builtin_ctz(++i))) {
+                std::complex<double> first = std::polar(1.0, phaseAccumulator * angleStep), second = std::polar(1.0, phaseAccumulator * fineAngleStep);
+                baseFactors[i] = vsetq_lane_f64(first.imag(), vsetq_lane_f64(first.real(), vdupq_n_f64(0.0), 0), 1);
+                baseFactors[i | halfSize] = vsetq_lane_f64(second.imag(), vsetq_lane_f64(second.real(), vdupq_n_f64(0.0), 0), 1);
+            }
+            for (std::uint32_t i = oldLength; i != newLength; ++i)
+                factors[i] = complexMultiply(baseFactors[i & (halfSize - 1)], baseFactors[halfSize | (i >> halfLog)]);
+            delete[] baseFactors;
+        }
+
         void resize(std::uint32_t transformLength) {
             if (transformLength > length << 1) {
-                std::uint32_t halfLog = detail::log2(transformLength) >> 1, halfSize = 1 << halfLog;
-                float64x2_t* baseFactors = new float64x2_t[halfSize << 1]();
-                const double angleStep = std::acos(-1.0) / halfSize, fineAngleStep = angleStep / halfSize;
-                for (std::uint32_t i = 0, j = (halfSize * 3) >> 1, phaseAccumulator = 0; i != halfSize; phaseAccumulator -= halfSize - (j >> __builtin_ctz(++i))) {
-                    std::complex<double> first = std::polar(1.0, phaseAccumulator * angleStep), second = std::polar(1.0, phaseAccumulator * fineAngleStep);
-                    baseFactors[i] = vsetq_lane_f64(first.imag(), vsetq_lane_f64(first.real(), vdupq_n_f64(0.0), 0), 1);
-                    baseFactors[i | halfSize] = vsetq_lane_f64(second.imag(), vsetq_lane_f64(second.real(), vdupq_n_f64(0.0), 0), 1);
-                }
-                float64x2_t* newFactors = new float64x2_t[transformLength >> 1];
-                std::memcpy(newFactors, twiddleFactors, length * sizeof(float64x2_t));
-                delete[] twiddleFactors;
-                twiddleFactors = newFactors;
-                for (std::uint32_t i = length; i != transformLength >> 1; ++i)
-                    twiddleFactors[i] = complexMultiply(baseFactors[i & (halfSize - 1)], baseFactors[halfSize | (i >> halfLog)]);
-                delete[] baseFactors;
-                length = transformLength >> 1;
+                INTEGER_PROFILE(TransformResize, transformLength);
+                twiddleFactors = sharedTwiddles().acquire(transformLength >> 1, growTwiddles, length);
             }
         }
 
-        void decimationInFrequency(float64x2_t* dataArray, std::uint32_t transformSize) {
-            for (std::uint32_t blockSize = transformSize >> 1, stepSize = transformSize; blockSize; stepSize = blockSize, blockSize >>= 1) {
-                for (float64x2_t* currentElement = dataArray; currentElement != dataArray + blockSize; ++currentElement) {
+        void forwardButterflies(float64x2_t* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+            if (!blockIndex)
+                for (float64x2_t* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
                     const float64x2_t evenElement = *currentElement, oddElement = currentElement[blockSize];
                     *currentElement = vaddq_f64(evenElement, oddElement);
                     currentElement[blockSize] = vsubq_f64(evenElement, oddElement);
                 }
-                for (float64x2_t *blockStart = dataArray + stepSize, *twiddlePointer = twiddleFactors + 1; blockStart != dataArray + transformSize; blockStart += stepSize, ++twiddlePointer) {
-                    for (float64x2_t* currentElement = blockStart; currentElement != blockStart + blockSize; ++currentElement) {
-                        const float64x2_t evenElement = *currentElement, oddElement = complexMultiply(currentElement[blockSize], *twiddlePointer);
-                        *currentElement = vaddq_f64(evenElement, oddElement);
-                        currentElement[blockSize] = vsubq_f64(evenElement, oddElement);
-                    }
+            else
+                for (float64x2_t *currentElement = blockStart, twiddle = twiddleFactors[blockIndex]; currentElement != blockStart + count; ++currentElement) {
+                    const float64x2_t evenElement = *currentElement, oddElement = complexMultiply(currentElement[blockSize], twiddle);
+                    *currentElement = vaddq_f64(evenElement, oddElement);
+                    currentElement[blockSize] = vsubq_f64(evenElement, oddElement);
                 }
-            }
         }
 
-        void decimationInTime(float64x2_t* dataArray, std::uint32_t transformSize) {
-            for (std::uint32_t blockSize = 1, stepSize = 2; blockSize != transformSize; blockSize = stepSize, stepSize <<= 1) {
-                for (float64x2_t* currentElement = dataArray; currentElement != dataArray + blockSize; ++currentElement) {
+        void inverseButterflies(float64x2_t* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+            if (!blockIndex)
+                for (float64x2_t* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
                     const float64x2_t evenElement = *currentElement, oddElement = currentElement[blockSize];
                     *currentElement = vaddq_f64(evenElement, oddElement);
                     currentElement[blockSize] = vsubq_f64(evenElement, oddElement);
                 }
-                for (float64x2_t *blockStart = dataArray + stepSize, *twiddlePointer = twiddleFactors + 1; blockStart != dataArray + transformSize; blockStart += stepSize, ++twiddlePointer) {
-                    for (float64x2_t* currentElement = blockStart; currentElement != blockStart + blockSize; ++currentElement) {
-                        const float64x2_t evenElement = *currentElement, oddElement = currentElement[blockSize];
-                        *currentElement = vaddq_f64(evenElement, oddElement);
-                        currentElement[blockSize] = complexMultiplyConjugate(vsubq_f64(evenElement, oddElement), *twiddlePointer);
-                    }
+            else
+                for (float64x2_t *currentElement = blockStart, twiddle = twiddleFactors[blockIndex]; currentElement != blockStart + count; ++currentElement) {
+                    const float64x2_t evenElement = *currentElement, oddElement = currentElement[blockSize];
+                    *currentElement = vaddq_f64(evenElement, oddElement);
+                    currentElement[blockSize] = complexMultiplyConjugate(vsubq_f64(evenElement, oddElement), twiddle);
                 }
+        }
+
+        void forwardQuadButterflies(float64x2_t* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+            const float64x2_t outerTwiddle = twiddleFactors[blockIndex], evenTwiddle = twiddleFactors[blockIndex << 1], oddTwiddle = twiddleFactors[blockIndex << 1 | 1];
+            for (float64x2_t* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
+                const float64x2_t firstElement = currentElement[0], secondElement = currentElement[quarterSize];
+                const float64x2_t thirdElement = blockIndex ? complexMultiply(currentElement[quarterSize << 1], outerTwiddle) : currentElement[quarterSize << 1];
+                const float64x2_t fourthElement = blockIndex ? complexMultiply(currentElement[quarterSize * 3], outerTwiddle) : currentElement[quarterSize * 3];
+                const float64x2_t upperEven = vaddq_f64(firstElement, thirdElement), lowerEven = vsubq_f64(firstElement, thirdElement);
+                const float64x2_t upperOdd = blockIndex ? complexMultiply(vaddq_f64(secondElement, fourthElement), evenTwiddle) : vaddq_f64(secondElement, fourthElement), lowerOdd = complexMultiply(vsubq_f64(secondElement, fourthElement), oddTwiddle);
+                currentElement[0] = vaddq_f64(upperEven, upperOdd), currentElement[quarterSize] = vsubq_f64(upperEven, upperOdd);
+                currentElement[quarterSize << 1] = vaddq_f64(lowerEven, lowerOdd), currentElement[quarterSize * 3] = vsubq_f64(lowerEven, lowerOdd);
             }
         }
 
-        void frequencyDomainPointwiseMultiply(float64x2_t* firstArray, float64x2_t* secondArray, std::uint32_t transformSize) {
-            const double normalizationFactor = 1.0 / transformSize, scalingFactor = normalizationFactor * 0.25;
-            firstArray[0] = complexScalarMultiply(complexMultiplySpecial(firstArray[0], secondArray[0]), normalizationFactor);
-            firstArray[1] = complexScalarMultiply(complexMultiply(firstArray[1], secondArray[1]), normalizationFactor);
+        void inverseQuadButterflies(float64x2_t* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+            const float64x2_t outerTwiddle = twiddleFactors[blockIndex], evenTwiddle = twiddleFactors[blockIndex << 1], oddTwiddle = twiddleFactors[blockIndex << 1 | 1];
+            for (float64x2_t* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
+                const float64x2_t firstElement = currentElement[0], secondElement = currentElement[quarterSize], thirdElement = currentElement[quarterSize << 1], fourthElement = currentElement[quarterSize * 3];
+                const float64x2_t upperSum = vaddq_f64(firstElement, secondElement), upperDifference = blockIndex ? complexMultiplyConjugate(vsubq_f64(firstElement, secondElement), evenTwiddle) : vsubq_f64(firstElement, secondElement);
+                const float64x2_t lowerSum = vaddq_f64(thirdElement, fourthElement), lowerDifference = complexMultiplyConjugate(vsubq_f64(thirdElement, fourthElement), oddTwiddle);
+                currentElement[0] = vaddq_f64(upperSum, lowerSum), currentElement[quarterSize] = vaddq_f64(upperDifference, lowerDifference);
+                currentElement[quarterSize << 1] = blockIndex ? complexMultiplyConjugate(vsubq_f64(upperSum, lowerSum), outerTwiddle) : vsubq_f64(upperSum, lowerSum);
+                currentElement[quarterSize * 3] = blockIndex ? complexMultiplyConjugate(vsubq_f64(upperDifference, lowerDifference), outerTwiddle) : vsubq_f64(upperDifference, lowerDifference);
+            }
+        }
+
+        void decimationInFrequency(float64x2_t* dataArray, std::uint32_t transformSize) const {
+            blockedDecimationInFrequency(*this, dataArray, transformSize, 0);
+        }
+
+        void decimationInTime(float64x2_t* dataArray, std::uint32_t transformSize) const {
+            blockedDecimationInTime(*this, dataArray, transformSize, 0);
+        }
+
+        void pointwiseMultiply(float64x2_t* firstArray, const float64x2_t* secondArray, std::uint32_t transformSize, std::uint32_t pairBegin, std::uint32_t pairEnd) const {
+            const double scalingFactor = 0.25 / transformSize;
             const float64x2_t conjugateMask = vsetq_lane_f64(-1.0, vsetq_lane_f64(1.0, vdupq_n_f64(0.0), 0), 1);
             const float64x2_t negateMask = vdupq_n_f64(-1.0);
-            for (std::uint32_t blockStart = 2, blockEnd = 3; blockStart != transformSize; blockStart <<= 1, blockEnd <<= 1) {
-                for (std::uint32_t forwardIndex = blockStart, backwardIndex = forwardIndex + blockStart - 1; forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
-                    auto conj = [&](float64x2_t v) { return vmulq_f64(v, conjugateMask); };
+            auto conj = [&](float64x2_t v) { return vmulq_f64(v, conjugateMask); };
+            for (std::uint32_t blockStart = 2u << detail::log2(pairBegin); pairBegin != pairEnd; pairBegin = std::min(pairEnd, blockStart), blockStart <<= 1) {
+                for (std::uint32_t forwardIndex = pairBegin + (blockStart >> 1), backwardIndex = 3 * blockStart - 1 - forwardIndex, blockEnd = std::min(pairEnd, blockStart) + (blockStart >> 1); forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
                     const float64x2_t firstEven = vaddq_f64(firstArray[forwardIndex], conj(firstArray[backwardIndex])), firstOdd = vsubq_f64(firstArray[forwardIndex], conj(firstArray[backwardIndex]));
                     const float64x2_t secondEven = vaddq_f64(secondArray[forwardIndex], conj(secondArray[backwardIndex])), secondOdd = vsubq_f64(secondArray[forwardIndex], conj(secondArray[backwardIndex]));
                     const float64x2_t twiddle = (forwardIndex & 1 ? vmulq_f64(twiddleFactors[forwardIndex >> 1], negateMask) : twiddleFactors[forwardIndex >> 1]);
@@ -294,18 +821,54 @@ namespace detail {
                 }
             }
         }
+
+        void pointwiseSquare(float64x2_t* dataArray, std::uint32_t transformSize, std::uint32_t pairBegin, std::uint32_t pairEnd) const {
+            const double scalingFactor = 0.25 / transformSize;
+            const float64x2_t conjugateMask = vsetq_lane_f64(-1.0, vsetq_lane_f64(1.0, vdupq_n_f64(0.0), 0), 1);
+            const float64x2_t negateMask = vdupq_n_f64(-1.0);
+            auto conj = [&](float64x2_t v) { return vmulq_f64(v, conjugateMask); };
+            for (std::uint32_t blockStart = 2u << detail::log2(pairBegin); pairBegin != pairEnd; pairBegin = std::min(pairEnd, blockStart), blockStart <<= 1) {
+                for (std::uint32_t forwardIndex = pairBegin + (blockStart >> 1), backwardIndex = 3 * blockStart - 1 - forwardIndex, blockEnd = std::min(pairEnd, blockStart) + (blockStart >> 1); forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
+                    const float64x2_t evenPart = vaddq_f64(dataArray[forwardIndex], conj(dataArray[backwardIndex])), oddPart = vsubq_f64(dataArray[forwardIndex], conj(dataArray[backwardIndex]));
+                    const float64x2_t twiddle = (forwardIndex & 1 ? vmulq_f64(twiddleFactors[forwardIndex >> 1], negateMask) : twiddleFactors[forwardIndex >> 1]);
+                    const float64x2_t crossProduct = complexMultiply(evenPart, oddPart);
+                    const float64x2_t productA = vsubq_f64(complexMultiply(evenPart, evenPart), complexMultiply(complexMultiply(oddPart, oddPart), twiddle)), productB = vaddq_f64(crossProduct, crossProduct);
+                    dataArray[forwardIndex] = complexScalarMultiply(vaddq_f64(productA, productB), scalingFactor);
+                    dataArray[backwardIndex] = conj(complexScalarMultiply(vsubq_f64(productA, productB), scalingFactor));
+                }
+            }
+        }
+
+        void pointwiseEndpoints(float64x2_t* firstArray, const float64x2_t* secondArray, std::uint32_t transformSize) const {
+            const double normalizationFactor = 1.0 / transformSize;
+            firstArray[0] = complexScalarMultiply(complexMultiplySpecial(firstArray[0], secondArray[0]), normalizationFactor);
+            firstArray[1] = complexScalarMultiply(complexMultiply(firstArray[1], secondArray[1]), normalizationFactor);
+        }
+
+        void frequencyDomainPointwiseMultiply(float64x2_t* firstArray, const float64x2_t* secondArray, std::uint32_t transformSize) {
+            pointwiseEndpoints(firstArray, secondArray, transformSize), pointwiseMultiply(firstArray, secondArray, transformSize, 1, transformSize >> 1);
+        }
+
+        void frequencyDomainPointwiseSquare(float64x2_t* dataArray, std::uint32_t transformSize) {
+            pointwiseEndpoints(dataArray, dataArray, transformSize), pointwiseSquare(dataArray, transformSize, 1, transformSize >> 1);
+        }
     };
 #else
     struct TransformHelper {
-        std::complex<double>* twiddleFactors;
+        using Complex = std::complex<double>;
+        using Factor = Complex;
+
+        const std::complex<double>* twiddleFactors;
         std::uint32_t length;
 
-        TransformHelper() : twiddleFactors(new std::complex<double>[1]()), length(1) {
-            *twiddleFactors = {1.0, 0.0};
+        TransformHelper() : twiddleFactors(nullptr), length(0) {
+            resize(2);
         }
 
-        ~TransformHelper() noexcept {
-            delete[] twiddleFactors;
+        static SharedTwiddleTable<TransformHelper>& sharedTwiddles() {
+            static const Factor unitFactor = {1.0, 0.0};
+            static SharedTwiddleTable<TransformHelper> table(&unitFactor);
+            return table;
         }
 
         static inline std::complex<double> complexMultiply(std::complex<double> first, std::complex<double> second) {
@@ -316,7 +879,7 @@ namespace detail {
             return first * std::conj(second);
         }
 
-        std::complex<double> complexMultiplySpecial(
+        static inline std::complex<double> complexMultiplySpecial(
             const std::complex<double>& first,
             const std::complex<double>& second) {
             double r1 = first.real();
@@ -335,66 +898,101 @@ namespace detail {
             return complex * scalar;
         }
 
+        static inline std::complex<double> splitDigit(std::uint32_t digit) {
+            return {static_cast<double>(digit % 10000u), static_cast<double>(digit / 10000u)};
+        }
+
+        static inline std::uint64_t mergeDigit(std::complex<double> value) {
+            return std::uint64_t(std::int64_t(value.real() + 0.5) + std::int64_t(value.imag() + 0.5) * 10000);
+        }
+
+        static void growTwiddles(std::complex<double>* factors, std::uint32_t oldLength, std::uint32_t newLength) {
+            std::uint32_t halfLog = detail::log2(newLength << 1) >> 1, halfSize = 1 << halfLog;
+            std::complex<double>* baseFactors = new std::complex<double>[halfSize << 1]();
+            const double angleStep = std::acos(-1.0) / halfSize, fineAngleStep = angleStep / halfSize;
+            for (std::uint32_t i = 0, j = (halfSize * 3) >> 1, phaseAccumulator = 0; i != halfSize; phaseAccumulator -= halfSize - (j >> __builtin_ctz(++i))) {
+                baseFactors[i] = std::polar(1.0, phaseAccumulator * angleStep);
+                baseFactors[i | halfSize] = std::polar(1.0, phaseAccumulator * fineAngleStep);
+            }
+            for (std::uint32_t i = oldLength; i != newLength; ++i)
+                factors[i] = baseFactors[i & (halfSize - 1)] * baseFactors[halfSize | (i >> halfLog)];
+            delete[] baseFactors;
+        }
+
         void resize(std::uint32_t transformLength) {
             if (transformLength > length << 1) {
-                std::uint32_t halfLog = detail::log2(transformLength) >> 1, halfSize = 1 << halfLog;
-                std::complex<double>* baseFactors = new std::complex<double>[halfSize << 1]();
-                const double angleStep = std::acos(-1.0) / halfSize, fineAngleStep = angleStep / halfSize;
-                for (std::uint32_t i = 0, j = (halfSize * 3) >> 1, phaseAccumulator = 0; i != halfSize; phaseAccumulator -= halfSize - (j >> __builtin_ctz(++i))) {
-                    baseFactors[i] = std::polar(1.0, phaseAccumulator * angleStep);
-                    baseFactors[i | halfSize] = std::polar(1.0, phaseAccumulator * fineAngleStep);
-                }
-                std::complex<double>* newFactors = new std::complex<double>[transformLength >> 1];
-                std::memcpy(newFactors, twiddleFactors, length * sizeof(std::complex<double>));
-                delete[] twiddleFactors;
-                twiddleFactors = newFactors;
-                for (std::uint32_t i = length; i != transformLength >> 1; ++i)
-                    twiddleFactors[i] = baseFactors[i & (halfSize - 1)] * baseFactors[halfSize | (i >> halfLog)];
-                delete[] baseFactors;
-                length = transformLength >> 1;
+                INTEGER_PROFILE(TransformResize, transformLength);
+                twiddleFactors = sharedTwiddles().acquire(transformLength >> 1, growTwiddles, length);
             }
         }
 
-        void decimationInFrequency(std::complex<double>* dataArray, std::uint32_t transformSize) {
-            for (std::uint32_t blockSize = transformSize >> 1, stepSize = transformSize; blockSize; stepSize = blockSize, blockSize >>= 1) {
-                for (std::complex<double>* currentElement = dataArray; currentElement != dataArray + blockSize; ++currentElement) {
+        void forwardButterflies(std::complex<double>* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+            if (!blockIndex)
+                for (std::complex<double>* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
                     const std::complex<double> evenElement = *currentElement, oddElement = currentElement[blockSize];
                     *currentElement = evenElement + oddElement;
                     currentElement[blockSize] = evenElement - oddElement;
                 }
-                for (std::complex<double>*blockStart = dataArray + stepSize, *twiddlePointer = twiddleFactors + 1; blockStart != dataArray + transformSize; blockStart += stepSize, ++twiddlePointer) {
-                    for (std::complex<double>* currentElement = blockStart; currentElement != blockStart + blockSize; ++currentElement) {
-                        const std::complex<double> evenElement = *currentElement, oddElement = currentElement[blockSize] * *twiddlePointer;
-                        *currentElement = evenElement + oddElement;
-                        currentElement[blockSize] = evenElement - oddElement;
-                    }
+            else
+                for (std::complex<double> *currentElement = blockStart, twiddle = twiddleFactors[blockIndex]; currentElement != blockStart + count; ++currentElement) {
+                    const std::complex<double> evenElement = *currentElement, oddElement = currentElement[blockSize] * twiddle;
+                    *currentElement = evenElement + oddElement;
+                    currentElement[blockSize] = evenElement - oddElement;
                 }
-            }
         }
 
-        void decimationInTime(std::complex<double>* dataArray, std::uint32_t transformSize) {
-            for (std::uint32_t blockSize = 1, stepSize = 2; blockSize != transformSize; blockSize = stepSize, stepSize <<= 1) {
-                for (std::complex<double>* currentElement = dataArray; currentElement != dataArray + blockSize; ++currentElement) {
+        void inverseButterflies(std::complex<double>* blockStart, std::uint32_t count, std::uint32_t blockSize, std::uint32_t blockIndex) const {
+            if (!blockIndex)
+                for (std::complex<double>* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
                     const std::complex<double> evenElement = *currentElement, oddElement = currentElement[blockSize];
                     *currentElement = evenElement + oddElement;
                     currentElement[blockSize] = evenElement - oddElement;
                 }
-                for (std::complex<double>*blockStart = dataArray + stepSize, *twiddlePointer = twiddleFactors + 1; blockStart != dataArray + transformSize; blockStart += stepSize, ++twiddlePointer) {
-                    for (std::complex<double>* currentElement = blockStart; currentElement != blockStart + blockSize; ++currentElement) {
-                        const std::complex<double> evenElement = *currentElement, oddElement = currentElement[blockSize];
-                        *currentElement = evenElement + oddElement;
-                        currentElement[blockSize] = (evenElement - oddElement) * std::conj(*twiddlePointer);
-                    }
+            else
+                for (std::complex<double> *currentElement = blockStart, twiddle = std::conj(twiddleFactors[blockIndex]); currentElement != blockStart + count; ++currentElement) {
+                    const std::complex<double> evenElement = *currentElement, oddElement = currentElement[blockSize];
+                    *currentElement = evenElement + oddElement;
+                    currentElement[blockSize] = (evenElement - oddElement) * twiddle;
                 }
+        }
+
+        void forwardQuadButterflies(std::complex<double>* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+            const std::complex<double> outerTwiddle = twiddleFactors[blockIndex], evenTwiddle = twiddleFactors[blockIndex << 1], oddTwiddle = twiddleFactors[blockIndex << 1 | 1];
+            for (std::complex<double>* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
+                const std::complex<double> firstElement = currentElement[0], secondElement = currentElement[quarterSize];
+                const std::complex<double> thirdElement = blockIndex ? currentElement[quarterSize << 1] * outerTwiddle : currentElement[quarterSize << 1];
+                const std::complex<double> fourthElement = blockIndex ? currentElement[quarterSize * 3] * outerTwiddle : currentElement[quarterSize * 3];
+                const std::complex<double> upperEven = firstElement + thirdElement, lowerEven = firstElement - thirdElement;
+                const std::complex<double> upperOdd = blockIndex ? (secondElement + fourthElement) * evenTwiddle : secondElement + fourthElement, lowerOdd = (secondElement - fourthElement) * oddTwiddle;
+                currentElement[0] = upperEven + upperOdd, currentElement[quarterSize] = upperEven - upperOdd;
+                currentElement[quarterSize << 1] = lowerEven + lowerOdd, currentElement[quarterSize * 3] = lowerEven - lowerOdd;
             }
         }
 
-        void frequencyDomainPointwiseMultiply(std::complex<double>* firstArray, std::complex<double>* secondArray, std::uint32_t transformSize) {
-            const double normalizationFactor = 1.0 / transformSize, scalingFactor = normalizationFactor * 0.25;
-            firstArray[0] = complexScalarMultiply(complexMultiplySpecial(firstArray[0], secondArray[0]), normalizationFactor);
-            firstArray[1] = complexScalarMultiply(complexMultiply(firstArray[1], secondArray[1]), normalizationFactor);
-            for (std::uint32_t blockStart = 2, blockEnd = 3; blockStart != transformSize; blockStart <<= 1, blockEnd <<= 1) {
-                for (std::uint32_t forwardIndex = blockStart, backwardIndex = forwardIndex + blockStart - 1; forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
+        void inverseQuadButterflies(std::complex<double>* blockStart, std::uint32_t count, std::uint32_t quarterSize, std::uint32_t blockIndex) const {
+            const std::complex<double> outerTwiddle = std::conj(twiddleFactors[blockIndex]), evenTwiddle = std::conj(twiddleFactors[blockIndex << 1]), oddTwiddle = std::conj(twiddleFactors[blockIndex << 1 | 1]);
+            for (std::complex<double>* currentElement = blockStart; currentElement != blockStart + count; ++currentElement) {
+                const std::complex<double> firstElement = currentElement[0], secondElement = currentElement[quarterSize], thirdElement = currentElement[quarterSize << 1], fourthElement = currentElement[quarterSize * 3];
+                const std::complex<double> upperSum = firstElement + secondElement, upperDifference = blockIndex ? (firstElement - secondElement) * evenTwiddle : firstElement - secondElement;
+                const std::complex<double> lowerSum = thirdElement + fourthElement, lowerDifference = (thirdElement - fourthElement) * oddTwiddle;
+                currentElement[0] = upperSum + lowerSum, currentElement[quarterSize] = upperDifference + lowerDifference;
+                currentElement[quarterSize << 1] = blockIndex ? (upperSum - lowerSum) * outerTwiddle : upperSum - lowerSum;
+                currentElement[quarterSize * 3] = blockIndex ? (upperDifference - lowerDifference) * outerTwiddle : upperDifference - lowerDifference;
+            }
+        }
+
+        void decimationInFrequency(std::complex<double>* dataArray, std::uint32_t transformSize) const {
+            blockedDecimationInFrequency(*this, dataArray, transformSize, 0);
+        }
+
+        void decimationInTime(std::complex<double>* dataArray, std::uint32_t transformSize) const {
+            blockedDecimationInTime(*this, dataArray, transformSize, 0);
+        }
+
+        void pointwiseMultiply(std::complex<double>* firstArray, const std::complex<double>* secondArray, std::uint32_t transformSize, std::uint32_t pairBegin, std::uint32_t pairEnd) const {
+            const double scalingFactor = 0.25 / transformSize;
+            for (std::uint32_t blockStart = 2u << detail::log2(pairBegin); pairBegin != pairEnd; pairBegin = std::min(pairEnd, blockStart), blockStart <<= 1) {
+                for (std::uint32_t forwardIndex = pairBegin + (blockStart >> 1), backwardIndex = 3 * blockStart - 1 - forwardIndex, blockEnd = std::min(pairEnd, blockStart) + (blockStart >> 1); forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
                     const std::complex<double> firstEven = firstArray[forwardIndex] + std::conj(firstArray[backwardIndex]), firstOdd = firstArray[forwardIndex] - std::conj(firstArray[backwardIndex]);
                     const std::complex<double> secondEven = secondArray[forwardIndex] + std::conj(secondArray[backwardIndex]), secondOdd = secondArray[forwardIndex] - std::conj(secondArray[backwardIndex]);
                     const std::complex<double> twiddle = (forwardIndex & 1 ? -twiddleFactors[forwardIndex >> 1] : twiddleFactors[forwardIndex >> 1]);
@@ -404,800 +1002,3949 @@ namespace detail {
                 }
             }
         }
-    };
-#endif
-
-    static __CONSTEXPR InputHelper I = {};
-    static __CONSTEXPR OutputHelper O = {};
-    static thread_local TransformHelper T = {};
-} // namespace detail
 
-class UnsignedInteger;
-class SignedInteger;
+        void pointwiseSquare(std::complex<double>* dataArray, std::uint32_t transformSize, std::uint32_t pairBegin, std::uint32_t pairEnd) const {
+            const double scalingFactor = 0.25 / transformSize;
+            for (std::uint32_t blockStart = 2u << detail::log2(pairBegin); pairBegin != pairEnd; pairBegin = std::min(pairEnd, blockStart), blockStart <<= 1) {
+                for (std::uint32_t forwardIndex = pairBegin + (blockStart >> 1), backwardIndex = 3 * blockStart - 1 - forwardIndex, blockEnd = std::min(pairEnd, blockStart) + (blockStart >> 1); forwardIndex != blockEnd; ++forwardIndex, --backwardIndex) {
+                    const std::complex<double> evenPart = dataArray[forwardIndex] + std::conj(dataArray[backwardIndex]), oddPart = dataArray[forwardIndex] - std::conj(dataArray[backwardIndex]);
+                    const std::complex<double> twiddle = (forwardIndex & 1 ? -twiddleFactors[forwardIndex >> 1] : twiddleFactors[forwardIndex >> 1]);
+                    const std::complex<double> productA = evenPart * evenPart - oddPart * oddPart * twiddle, productB = 2.0 * evenPart * oddPart;
+                    dataArray[forwardIndex] = (productA + productB) * scalingFactor;
+                    dataArray[backwardIndex] = std::conj((productA - productB) * scalingFactor);
+                }
+            }
+        }
+
+        void pointwiseEndpoints(std::complex<double>* firstArray, const std::complex<double>* secondArray, std::uint32_t transformSize) const {
+            const double normalizationFactor = 1.0 / transformSize;
+            firstArray[0] = complexScalarMultiply(complexMultiplySpecial(firstArray[0], secondArray[0]), normalizationFactor);
+            firstArray[1] = complexScalarMultiply(complexMultiply(firstArray[1], secondArray[1]), normalizationFactor);
+        }
+
+        void frequencyDomainPointwiseMultiply(std::complex<double>* firstArray, const std::complex<double>* secondArray, std::uint32_t transformSize) {
+            pointwiseEndpoints(firstArray, secondArray, transformSize), pointwiseMultiply(firstArray, secondArray, transformSize, 1, transformSize >> 1);
+        }
+
+        void frequencyDomainPointwiseSquare(std::complex<double>* dataArray, std::uint32_t transformSize) {
+            pointwiseEndpoints(dataArray, dataArray, transformSize), pointwiseSquare(dataArray, transformSize, 1, transformSize >> 1);
+        }
+    };
+#endif
+
+    constexpr std::uint32_t newtonInverseStep(std::uint32_t modulus, std::uint32_t inverse) {
+        return inverse * (2u - modulus * inverse);
+    }
+
+    template <std::uint32_t Modulus, std::uint32_t PrimitiveRoot>
+    struct ModularTransformHelper {
+        using Factor = std::uint32_t;
+
+        static constexpr std::uint32_t ModulusInverse = newtonInverseStep(Modulus, newtonInverseStep(Modulus, newtonInverseStep(Modulus, newtonInverseStep(Modulus, Modulus))));
+        static constexpr std::uint32_t MontgomeryOne = std::uint32_t((std::uint64_t(1) << 32) % Modulus);
+        static constexpr std::uint32_t MontgomerySquare = std::uint32_t(std::uint64_t(MontgomeryOne) * MontgomeryOne % Modulus);
+
+        const std::uint32_t *twiddleFactors, *inverseTwiddleFactors;
+        std::uint32_t length;
+
+        ModularTransformHelper() : twiddleFactors(nullptr), inverseTwiddleFactors(nullptr), length(0) {
+            resize(2);
+        }
+
+        static SharedTwiddleTable<ModularTransformHelper, 2>& sharedTwiddles() {
+            static const Factor unitFactors[2] = {MontgomeryOne, MontgomeryOne};
+            static SharedTwiddleTable<ModularTransformHelper, 2> table(unitFactors);
+            return table;
+        }
+
+        static inline std::uint32_t modularAdd(std::uint32_t first, std::uint32_t second) {
+            const std::uint32_t sum = first + second;
+            return std::min(sum, sum - Modulus);
+        }
+
+        static inline std::uint32_t modularSubtract(std::uint32_t first, std::uint32_t second) {
+            const std::uint32_t difference = first - second;
+            return std::min(difference, difference + Modulus);
+        }
+
+        static inline std::uint32_t modularMultiply(std::uint32_t first, std::uint32_t second) {
+            const std::uint64_t product = std::uint64_t(first) * second;
+            const std::uint32_t result = std::uint32_t(product >> 32) - std::uint32_t((std::uint64_t(std::uint32_t(product) * ModulusInverse) * Modulus) >> 32);
+            return std::min(result, result + Modulus);
+        }
+
+#if defined(__AVX2__)
+        static inline __m256i modularAdd(__m256i first, __m256i second) {
+            const __m256i sum = _mm256_add_epi32(first, second);
+            return _mm256_min_epu32(sum, _mm256_sub_epi32(sum, _mm256_set1_epi32(int(Modulus))));
+        }
+
+        static inline __m256i modularSubtract(__m256i first, __m256i second) {
+            const __m256i difference = _mm256_sub_epi32(first, second);
+            return _mm256_min_epu32(difference, _mm256_add_epi32(difference, _mm256_set1_epi32(int(Modulus))));
+        }
+
+        static inline __m256i modularMultiply(__m256i first, __m256i second) {
+            const __m256i modulus = _mm256_set1_epi32(int(Modulus)), modulusInverse = _mm256_set1_epi32(int(ModulusInverse));
+            const __m256i evenProduct = _mm256_mul_epu32(first, second), oddProduct = _mm256_mul_epu32(_mm256_srli_epi64(first, 32), _mm256_srli_epi64(second, 32));
+            const __m256i evenReduced = _mm256_sub_epi64(evenProduct, _mm256_mul_epu32(_mm256_mul_epu32(evenProduct, modulusInverse), modulus));
+            const __m256i oddReduced = _mm256_sub_epi64(oddProduct, _mm256_mul_epu32(_mm256_mul_epu32(oddProduct, modulusInverse), modulus));
+            const __m256i result = _mm256_blend_epi32(_mm256_srli_epi64(evenReduced, 32), oddReduced, 0xAA);
+            return _mm256_min_epu32(result, _mm256_add_epi32(result, modulus));
+        }
+#elif defined(__ARM_NEON__)
+        static inline uint32x4_t modularAdd(uint32x4_t first, uint32x4_t second) {
+            const uint32x4_t sum = vaddq_u32(first, second);
+            return vminq_u32(sum, vsubq_u32(sum, vdupq_n_u32(Modulus)));
+        }
+
+        static inline uint32x4_t modularSubtract(uint32x4_t first, uint32x4_t second) {
+            const uint32x4_t difference = vsubq_u32(first, second);
+            return vminq_u32(difference, vaddq_u32(difference, vdupq_n_u32(Modulus)));
+        }
+
+        static inline uint32x4_t modularMultiply(uint32x4_t first, uint32x4_t second) {
+            const uint32x4_t modulus = vdupq_n_u32(Modulus);
+            const uint32x4_t lowProduct = vreinterpretq_u32_u64(vmull_u32(vget_low_u32(first), vget_low_u32(second))), highProduct = vreinterpretq_u32_u64(vmull_high_u32(first, second));
+            const uint32x4_t quotient = vmulq_u32(vuzp1q_u32(lowProduct, highProduct), vdupq_n_u32(ModulusInverse));
+            const uint32x4_t correction = vuzp2q_u32(vreinterpretq_u32_u64(vmull_u32(vget_low_u32(quotient), vget_low_u32(modulus))), vreinterpretq_u32_u64(vmull_high_u32(quotient, modulus)));
+            const uint32x4_t result = vsubq_u32(vuzp2q_u32(lowProduct, highProduct), correction);
+            return vminq_u32(result, vaddq_u32(result, modulus));
+        }
+#endif
+
+        static std::uint32_t modularPower(std::uint32_t base, std::uint32_t exponent) {
+            std::uint32_t result = MontgomeryOne;
+            for (base = modularMultiply(base, MontgomerySquare); exponent; exponent >>= 1, base = modularMultiply(base, base))
+                if (exponent & 1)
+                    result = modularMultiply(result, base);
+            return result;
+        }
+
+        static void growTwiddles(std::uint32_t* factors, std::uint32_t oldLength, std::uint32_t newLength) {
+            for (std::uint32_t levelSize = oldLength; levelSize != newLength; levelSize <<= 1) {
+                const std::uint32_t root = modularPower(PrimitiveRoot, (Modulus - 1) / (levelSize << 2)), inverseRoot = modularPower(PrimitiveRoot, Modulus - 1 - (Modulus - 1) / (levelSize << 2));
+                const std::uint32_t rootSquare = modularMultiply(root, root), inverseRootSquare = modularMultiply(inverseRoot, inverseRoot);
+                std::uint32_t power = root, inversePower = inverseRoot;
+                for (std::uint32_t i = 0, reversed = 0; i != levelSize; ++i, power = modularMultiply(power, rootSquare), inversePower = modularMultiply(inversePower, inverseRootSquare)) {
+                    factors[levelSize | reversed] = power, factors[newLength | levelSize | reversed] = inversePower;
+                    for (std::uint32_t bit = levelSize >> 1; (reversed ^= bit) < bit; bit >>= 1);
+                }
+            }
+        }
+
+        void resize(std::uint32_t transformLength) {
+            if (transformLength > length << 1) {
+                INTEGER_PROFILE(TransformResize, transformLength);
+                twiddleFactors = sharedTwiddles().acquire(transformLength >> 1, growTwiddles, length), inverseTwiddleFactors = twiddleFactors + length;
+            }
+        }
+
+        static void forwardButterflies(std::uint32_t* blockStart, std::uint32_t blockSize, std::uint32_t twiddle) {
+            std::uint32_t* currentElement = blockStart;
+#if defined(__AVX2__)
+            const __m256i twiddleVector = _mm256_set1_epi32(int(twiddle));
+            for (; currentElement + 8 <= blockStart + blockSize; currentElement += 8) {
+                const __m256i evenElement = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(currentElement)), oddElement = modularMultiply(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(currentElement + blockSize)), twiddleVector);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(currentElement), modularAdd(evenElement, oddElement)), _mm256_storeu_si256(reinterpret_cast<__m256i*>(currentElement + blockSize), modularSubtract(evenElement, oddElement));
+            }
+#elif defined(__ARM_NEON__)
+            const uint32x4_t twiddleVector = vdupq_n_u32(twiddle);
+            for (; currentElement + 4 <= blockStart + blockSize; currentElement += 4) {
+                const uint32x4_t evenElement = vld1q_u32(currentElement), oddElement = modularMultiply(vld1q_u32(currentElement + blockSize), twiddleVector);
+                vst1q_u32(currentElement, modularAdd(evenElement, oddElement)), vst1q_u32(currentElement + blockSize, modularSubtract(evenElement, oddElement));
+            }
+#endif
+            for (; currentElement != blockStart + blockSize; ++currentElement) {
+                const std::uint32_t evenElement = *currentElement, oddElement = modularMultiply(currentElement[blockSize], twiddle);
+                *currentElement = modularAdd(evenElement, oddElement), currentElement[blockSize] = modularSubtract(evenElement, oddElement);
+            }
+        }
+
+        static void inverseButterflies(std::uint32_t* blockStart, std::uint32_t blockSize, std::uint32_t twiddle) {
+            std::uint32_t* currentElement = blockStart;
+#if defined(__AVX2__)
+            const __m256i twiddleVector = _mm256_set1_epi32(int(twiddle));
+            for (; currentElement + 8 <= blockStart + blockSize; currentElement += 8) {
+                const __m256i evenElement = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(currentElement)), oddElement = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(currentElement + blockSize));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(currentElement), modularAdd(evenElement, oddElement)), _mm256_storeu_si256(reinterpret_cast<__m256i*>(currentElement + blockSize), modularMultiply(modularSubtract(evenElement, oddElement), twiddleVector));
+            }
+#elif defined(__ARM_NEON__)
+            const uint32x4_t twiddleVector = vdupq_n_u32(twiddle);
+            for (; currentElement + 4 <= blockStart + blockSize; currentElement += 4) {
+                const uint32x4_t evenElement = vld1q_u32(currentElement), oddElement = vld1q_u32(currentElement + blockSize);
+                vst1q_u32(currentElement, modularAdd(evenElement, oddElement)), vst1q_u32(currentElement + blockSize, modularMultiply(modularSubtract(evenElement, oddElement), twiddleVector));
+            }
+#endif
+            for (; currentElement != blockStart + blockSize; ++currentElement) {
+                const std::uint32_t evenElement = *currentElement, oddElement = currentElement[blockSize];
+                *currentElement = modularAdd(evenElement, oddElement), currentElement[blockSize] = modularMultiply(modularSubtract(evenElement, oddElement), twiddle);
+            }
+        }
+
+        void decimationInFrequency(std::uint32_t* dataArray, std::uint32_t transformSize) {
+            for (std::uint32_t blockSize = transformSize >> 1, stepSize = transformSize; blockSize; stepSize = blockSize, blockSize >>= 1)
+                for (std::uint32_t blockIndex = 0; blockIndex != transformSize / stepSize; ++blockIndex)
+                    forwardButterflies(dataArray + blockIndex * stepSize, blockSize, twiddleFactors[blockIndex]);
+        }
+
+        void decimationInTime(std::uint32_t* dataArray, std::uint32_t transformSize) {
+            for (std::uint32_t blockSize = 1, stepSize = 2; blockSize != transformSize; blockSize = stepSize, stepSize <<= 1)
+                for (std::uint32_t blockIndex = 0; blockIndex != transformSize / stepSize; ++blockIndex)
+                    inverseButterflies(dataArray + blockIndex * stepSize, blockSize, inverseTwiddleFactors[blockIndex]);
+        }
+
+        void frequencyDomainPointwiseMultiply(std::uint32_t* firstArray, const std::uint32_t* secondArray, std::uint32_t transformSize) {
+            const std::uint32_t scalingFactor = modularMultiply(Modulus - (Modulus - 1) / transformSize, modularMultiply(MontgomerySquare, MontgomerySquare));
+            std::uint32_t i = 0;
+#if defined(__AVX2__)
+            for (const __m256i scalingVector = _mm256_set1_epi32(int(scalingFactor)); i + 8 <= transformSize; i += 8)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(firstArray + i), modularMultiply(modularMultiply(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(firstArray + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secondArray + i))), scalingVector));
+#elif defined(__ARM_NEON__)
+            for (const uint32x4_t scalingVector = vdupq_n_u32(scalingFactor); i + 4 <= transformSize; i += 4)
+                vst1q_u32(firstArray + i, modularMultiply(modularMultiply(vld1q_u32(firstArray + i), vld1q_u32(secondArray + i)), scalingVector));
+#endif
+            for (; i != transformSize; ++i)
+                firstArray[i] = modularMultiply(modularMultiply(firstArray[i], secondArray[i]), scalingFactor);
+        }
+    };
+
+    static __CONSTEXPR InputHelper I = {};
+    static __CONSTEXPR OutputHelper O = {};
+    static thread_local TransformHelper T = {};
+    static thread_local ModularTransformHelper<2013265921u, 31u> M0 = {};
+    static thread_local ModularTransformHelper<1811939329u, 13u> M1 = {};
+    static thread_local ModularTransformHelper<469762049u, 3u> M2 = {};
+    static thread_local ScratchBuffer TransformBuffers[2], ModularBuffers[4];
+} // namespace detail
+
+class UnsignedInteger;
+class UnsignedIntegerView;
+class SignedInteger;
+class PreparedMultiplier;
+class BarrettContext;
+template <std::uint32_t Limbs>
+class FixedUnsignedInteger;
+template <std::uint32_t Limbs>
+class FixedSignedInteger;
+
+namespace detail {
+    struct RadixPowers;
+}
+
+class IntegerMemoryResource {
+  public:
+    virtual ~IntegerMemoryResource() = default;
+
+    virtual std::uint32_t* allocate(std::uint32_t count) = 0;
+
+    virtual void deallocate(std::uint32_t* pointer, std::uint32_t count) noexcept = 0;
+
+    virtual std::uint32_t growCapacity(std::uint32_t currentCapacity, std::uint32_t requiredCapacity) const {
+        return std::max(requiredCapacity, currentCapacity + (currentCapacity >> 1));
+    }
+
+    static IntegerMemoryResource*& current() noexcept {
+        thread_local IntegerMemoryResource* resource = nullptr;
+        return resource;
+    }
+};
+
+class IntegerMemoryScope {
+    IntegerMemoryResource* previous;
+
+  public:
+    explicit IntegerMemoryScope(IntegerMemoryResource* resource) noexcept : previous(IntegerMemoryResource::current()) {
+        IntegerMemoryResource::current() = resource;
+    }
+
+    IntegerMemoryScope(const IntegerMemoryScope&) = delete;
+
+    IntegerMemoryScope& operator=(const IntegerMemoryScope&) = delete;
+
+    ~IntegerMemoryScope() noexcept {
+        IntegerMemoryResource::current() = previous;
+    }
+};
+
+class IntegerArena : public IntegerMemoryResource {
+    std::vector<std::uint32_t*> blocks;
+    std::uint32_t *position, *end, initialBlockSize, blockSize;
+
+  public:
+    static constexpr std::uint32_t MaxBlockSize = 1 << 22;
+
+    explicit IntegerArena(std::uint32_t initialBlockSize = 1 << 16) : position(nullptr), end(nullptr), initialBlockSize(initialBlockSize ? initialBlockSize : 1), blockSize(this->initialBlockSize) {}
+
+    IntegerArena(const IntegerArena&) = delete;
+
+    IntegerArena& operator=(const IntegerArena&) = delete;
+
+    ~IntegerArena() noexcept override {
+        release();
+    }
+
+    std::uint32_t* allocate(std::uint32_t count) override {
+        if (std::uint32_t(end - position) < count) {
+            const std::uint32_t newBlockSize = std::max(count, blockSize);
+            blocks.reserve(blocks.size() + 1);
+            blocks.push_back(position = new std::uint32_t[newBlockSize]), end = position + newBlockSize;
+            blockSize = blockSize < MaxBlockSize / 2 ? blockSize << 1 : MaxBlockSize;
+        }
+        std::uint32_t* result = position;
+        return position += count, result;
+    }
+
+    void deallocate(std::uint32_t* pointer, std::uint32_t count) noexcept override {
+        if (pointer + count == position)
+            position = pointer;
+    }
+
+    void release() noexcept {
+        for (std::uint32_t* block : blocks)
+            delete[] block;
+        blocks.clear(), position = end = nullptr, blockSize = initialBlockSize;
+    }
+};
+
+class IntegerExecutor {
+  public:
+    virtual ~IntegerExecutor() = default;
+
+    virtual std::uint32_t concurrency() const = 0;
+
+    virtual void run(std::uint32_t taskCount, const std::function<void(std::uint32_t)>& task) = 0;
+
+    static IntegerExecutor*& current() noexcept {
+        thread_local IntegerExecutor* executor = nullptr;
+        return executor;
+    }
+};
+
+class IntegerExecutorScope {
+    IntegerExecutor* previous;
+
+  public:
+    explicit IntegerExecutorScope(IntegerExecutor* executor) noexcept : previous(IntegerExecutor::current()) {
+        IntegerExecutor::current() = executor;
+    }
+
+    IntegerExecutorScope(const IntegerExecutorScope&) = delete;
+
+    IntegerExecutorScope& operator=(const IntegerExecutorScope&) = delete;
+
+    ~IntegerExecutorScope() noexcept {
+        IntegerExecutor::current() = previous;
+    }
+};
+
+class IntegerThreadPool : public IntegerExecutor {
+    std::vector<std::thread> workers;
+    std::mutex runMutex, stateMutex;
+    std::condition_variable wakeCondition, doneCondition;
+    const std::function<void(std::uint32_t)>* job;
+    std::uint32_t taskCount, nextTask, finishedTasks;
+    std::uint64_t generation;
+    bool stopping;
+
+    void work(std::unique_lock<std::mutex>& lock) {
+        while (nextTask < taskCount) {
+            const std::uint32_t task = nextTask++;
+            lock.unlock(), (*job)(task), lock.lock();
+            if (++finishedTasks == taskCount)
+                doneCondition.notify_all();
+        }
+    }
+
+  public:
+    explicit IntegerThreadPool(std::uint32_t threadCount = std::thread::hardware_concurrency()) : job(nullptr), taskCount(0), nextTask(0), finishedTasks(0), generation(0), stopping(false) {
+        for (std::uint32_t i = 1; i < threadCount; ++i)
+            workers.emplace_back([this] {
+                std::unique_lock<std::mutex> lock(stateMutex);
+                for (std::uint64_t seenGeneration = 0;;) {
+                    wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                    if (stopping)
+                        return;
+                    seenGeneration = generation, work(lock);
+                }
+            });
+    }
+
+    IntegerThreadPool(const IntegerThreadPool&) = delete;
+
+    IntegerThreadPool& operator=(const IntegerThreadPool&) = delete;
+
+    ~IntegerThreadPool() noexcept override {
+        {
+            const std::lock_guard<std::mutex> lock(stateMutex);
+            stopping = true;
+        }
+        wakeCondition.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    std::uint32_t concurrency() const override {
+        return std::uint32_t(workers.size()) + 1;
+    }
+
+    void run(std::uint32_t count, const std::function<void(std::uint32_t)>& task) override {
+        if (count < 2 || workers.empty()) {
+            for (std::uint32_t i = 0; i != count; ++i)
+                task(i);
+            return;
+        }
+        const std::lock_guard<std::mutex> runLock(runMutex);
+        std::unique_lock<std::mutex> lock(stateMutex);
+        job = &task, taskCount = count, nextTask = finishedTasks = 0, ++generation;
+        wakeCondition.notify_all(), work(lock);
+        doneCondition.wait(lock, [&] { return finishedTasks == taskCount; });
+    }
+};
+
+namespace detail {
+    template <typename Function>
+    void parallelFor(IntegerExecutor* executor, std::uint32_t taskCount, std::uint32_t count, Function function) {
+        if (taskCount < 2)
+            return function(0, count, 0);
+        const std::uint32_t chunkLength = (count + taskCount - 1) / taskCount;
+        executor->run(taskCount, [&](std::uint32_t task) {
+            function(std::min(count, task * chunkLength), std::min(count, (task + 1) * chunkLength), task);
+        });
+    }
+
+    // parallelFor for tasks that build integers: each task runs without the caller's executor and memory resource, and the exception of the
+    // lowest-numbered failing task is rethrown once every task has finished.
+    template <typename Function>
+    void isolatedParallelFor(IntegerExecutor* executor, std::uint32_t taskCount, std::uint32_t count, Function function) {
+        std::vector<std::exception_ptr> failures(taskCount);
+        parallelFor(executor, taskCount, count, [&](std::uint32_t begin, std::uint32_t end, std::uint32_t task) {
+            const IntegerExecutorScope executorScope(nullptr);
+            const IntegerMemoryScope memoryScope(nullptr);
+            try {
+                function(begin, end, task);
+            } catch (...) {
+                failures[task] = std::current_exception();
+            }
+        });
+        for (const std::exception_ptr& failure : failures)
+            if (failure)
+                std::rethrow_exception(failure);
+    }
+
+    template <typename Helper, typename Element>
+    void decimationInFrequency(Helper& helper, Element* dataArray, std::uint32_t transformSize, IntegerExecutor* executor, std::uint32_t taskCount) {
+        if (taskCount < 2)
+            return helper.decimationInFrequency(dataArray, transformSize);
+        std::uint32_t blockSize = transformSize >> 1, stepSize = transformSize;
+        for (; transformSize / stepSize != taskCount; stepSize = blockSize, blockSize >>= 1) {
+            const std::uint32_t tasksPerBlock = taskCount / (transformSize / stepSize), chunkLength = blockSize / tasksPerBlock;
+            executor->run(taskCount, [&](std::uint32_t task) {
+                helper.forwardButterflies(dataArray + task / tasksPerBlock * stepSize + task % tasksPerBlock * chunkLength, chunkLength, blockSize, task / tasksPerBlock);
+            });
+        }
+        executor->run(taskCount, [&](std::uint32_t task) {
+            blockedDecimationInFrequency(helper, dataArray + task * stepSize, stepSize, task);
+        });
+    }
+
+    template <typename Helper, typename Element>
+    void decimationInTime(Helper& helper, Element* dataArray, std::uint32_t transformSize, IntegerExecutor* executor, std::uint32_t taskCount) {
+        if (taskCount < 2)
+            return helper.decimationInTime(dataArray, transformSize);
+        const std::uint32_t subSize = transformSize / taskCount;
+        executor->run(taskCount, [&](std::uint32_t task) {
+            blockedDecimationInTime(helper, dataArray + task * subSize, subSize, task);
+        });
+        for (std::uint32_t blockSize = subSize, stepSize = subSize << 1; blockSize != transformSize; blockSize = stepSize, stepSize <<= 1) {
+            const std::uint32_t tasksPerBlock = taskCount / (transformSize / stepSize), chunkLength = blockSize / tasksPerBlock;
+            executor->run(taskCount, [&](std::uint32_t task) {
+                helper.inverseButterflies(dataArray + task / tasksPerBlock * stepSize + task % tasksPerBlock * chunkLength, chunkLength, blockSize, task / tasksPerBlock);
+            });
+        }
+    }
+
+    template <typename Helper, typename Element>
+    void frequencyDomainPointwiseMultiply(Helper& helper, Element* firstArray, const Element* secondArray, std::uint32_t transformSize, IntegerExecutor* executor, std::uint32_t taskCount) {
+        if (taskCount < 2)
+            return secondArray ? helper.frequencyDomainPointwiseMultiply(firstArray, secondArray, transformSize) : helper.frequencyDomainPointwiseSquare(firstArray, transformSize);
+        executor->run(taskCount, [&](std::uint32_t task) {
+            const std::uint32_t pairBegin = std::max(1u, (transformSize >> 1) / taskCount * task), pairEnd = (transformSize >> 1) / taskCount * (task + 1);
+            if (secondArray)
+                helper.pointwiseMultiply(firstArray, secondArray, transformSize, pairBegin, pairEnd);
+            else
+                helper.pointwiseSquare(firstArray, transformSize, pairBegin, pairEnd);
+        });
+        helper.pointwiseEndpoints(firstArray, secondArray ? secondArray : firstArray, transformSize);
+    }
+
+    // Binary format: "INTG", version, flags (bit 0: negative), two zero bytes, little-endian uint32 limb count, then the base-1e8 limbs as little-endian uint32.
+    static constexpr std::uint8_t SerializedMagic[4] = {'I', 'N', 'T', 'G'};
+    static constexpr std::uint8_t SerializedVersion = 1;
+    static constexpr std::size_t SerializedHeaderSize = 12;
+
+    static constexpr std::uint32_t DecimalPowers[9] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+    // Bit i of the mask is set when i is a square modulo Modulus.
+    template <std::uint32_t Modulus>
+    struct QuadraticResidueMask {
+        std::uint64_t words[(Modulus + 63) >> 6];
+
+        constexpr QuadraticResidueMask() : words() {
+            for (std::uint32_t i = 0; i <= Modulus >> 1; ++i)
+                words[i * i % Modulus >> 6] |= std::uint64_t(1) << (i * i % Modulus & 63);
+        }
+
+        constexpr bool contains(std::uint64_t value) const noexcept {
+            return words[value % Modulus >> 6] >> (value % Modulus & 63) & 1;
+        }
+    };
+
+    template <std::uint32_t Modulus>
+    static constexpr QuadraticResidueMask<Modulus> QuadraticResidues{};
+
+    inline bool littleEndianHost() noexcept {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+        return __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__;
+#else
+        return true;
+#endif
+    }
+
+    inline void storeLittleEndian(std::uint8_t* destination, const std::uint32_t* source, std::uint32_t count) noexcept {
+        if (littleEndianHost())
+            std::memcpy(destination, source, std::size_t(count) << 2);
+        else
+            for (std::uint32_t i = 0; i != count; ++i, destination += 4)
+                destination[0] = std::uint8_t(source[i]), destination[1] = std::uint8_t(source[i] >> 8), destination[2] = std::uint8_t(source[i] >> 16), destination[3] = std::uint8_t(source[i] >> 24);
+    }
+
+    inline void loadLittleEndian(std::uint32_t* destination, const std::uint8_t* source, std::uint32_t count) noexcept {
+        if (littleEndianHost())
+            std::memcpy(destination, source, std::size_t(count) << 2);
+        else
+            for (std::uint32_t i = 0; i != count; ++i, source += 4)
+                destination[i] = std::uint32_t(source[0]) | std::uint32_t(source[1]) << 8 | std::uint32_t(source[2]) << 16 | std::uint32_t(source[3]) << 24;
+    }
+
+    struct BorrowedDigits : IntegerMemoryResource {
+        std::uint32_t* allocate(std::uint32_t) override {
+            throw std::logic_error("UnsignedIntegerView error: borrowed digits are read-only.");
+        }
+
+        void deallocate(std::uint32_t*, std::uint32_t) noexcept override {}
+
+        static BorrowedDigits* instance() noexcept {
+            static BorrowedDigits resource;
+            return &resource;
+        }
+    };
+} // namespace detail
+
+class UnsignedInteger {
+    static constexpr std::uint32_t Base = 100000000;
+    static constexpr std::uint32_t TransformLimit = INTEGER_TRANSFORM_LIMIT;
+    static constexpr std::uint32_t ModularTransformLimit = 67108864;
+    static constexpr std::uint32_t BruteforceThreshold = 64;
+    static constexpr std::uint32_t MultiplyThreshold = 16;
+    static constexpr std::uint32_t MultiplyLengthThreshold = 80;
+    static constexpr std::uint32_t SquareThreshold = 48;
+    static constexpr std::uint32_t UnbalancedRatio = 16;
+    static constexpr std::uint32_t WrapAroundRatio = 4;
+    static constexpr std::uint32_t RadixLeafThreshold = 32;
+    static constexpr std::uint32_t SqrtBruteforceThreshold = 4;
+    static constexpr std::uint32_t HalfGcdThreshold = 64;
+    static constexpr std::uint32_t InlineCapacity = 4;
+    static constexpr std::uint32_t ParallelTransformThreshold = 1 << 15;
+    static constexpr std::uint32_t ParallelTransformGrain = 1 << 12;
+
+    IntegerMemoryResource* resource;
+    std::uint32_t *digits, length, capacity;
+    std::uint32_t inlineDigits[InlineCapacity];
+
+  protected:
+    UnsignedInteger(std::uint32_t initialLength, std::uint32_t initialCapacity) : resource(IntegerMemoryResource::current()), digits(initialCapacity > InlineCapacity ? allocateDigits(initialCapacity) : inlineDigits), length(initialLength), capacity(initialCapacity > InlineCapacity ? initialCapacity : InlineCapacity) {}
+
+    std::uint32_t* allocateDigits(std::uint32_t count) const {
+        INTEGER_PROFILE_ALLOCATION(std::uint64_t(count) << 2);
+        return resource ? resource->allocate(count) : new std::uint32_t[count];
+    }
+
+    void releaseDigits() noexcept {
+        if (digits != inlineDigits) {
+            if (resource)
+                resource->deallocate(digits, capacity);
+            else
+                delete[] digits;
+        }
+    }
+
+    void reserveDiscarding(std::uint32_t newCapacity) {
+        if (newCapacity > capacity) {
+            std::uint32_t* newMemory = allocateDigits(newCapacity);
+            releaseDigits(), digits = newMemory, capacity = newCapacity;
+        }
+    }
+
+    void resize(std::uint32_t newLength) {
+        if (newLength > capacity) {
+            const std::uint32_t newCapacity = resource ? resource->growCapacity(capacity, newLength) : std::max(newLength, capacity + (capacity >> 1));
+            std::uint32_t* newMemory = reinterpret_cast<std::uint32_t*>(std::memcpy(allocateDigits(newCapacity), digits, length << 2));
+            releaseDigits(), digits = newMemory, capacity = newCapacity;
+        }
+        length = newLength;
+    }
+
+    void stealDigits(UnsignedInteger& other) {
+        if (other.digits == other.inlineDigits || other.resource != resource)
+            reserveDiscarding(other.length), std::memcpy(digits, other.digits, other.length << 2), length = other.length;
+        else {
+            releaseDigits(), digits = other.digits, length = other.length, capacity = other.capacity;
+            other.digits = other.inlineDigits, other.capacity = InlineCapacity;
+        }
+        other.length = 1, other.digits[0] = 0;
+    }
+
+    void construct(const char* value, std::uint32_t stringLength) {
+        std::uint32_t* currentDigit = digits + length - 1;
+        switch (stringLength & 7) {
+            case 0:
+                ++currentDigit;
+                break;
+            case 1:
+                *currentDigit = *value & 15;
+                break;
+            case 2:
+                *currentDigit = detail::I(value);
+                break;
+            case 3:
+                *currentDigit = (*value & 15) * 100 + detail::I(value + 1);
+                break;
+            case 4:
+                *currentDigit = detail::I(value) * 100 + detail::I(value + 2);
+                break;
+            case 5:
+                *currentDigit = (*value & 15) * 10000 + detail::I(value + 1) * 100 + detail::I(value + 3);
+                break;
+            case 6:
+                *currentDigit = detail::I(value) * 10000 + detail::I(value + 2) * 100 + detail::I(value + 4);
+                break;
+            case 7:
+                *currentDigit = (*value & 15) * 1000000 + detail::I(value + 1) * 10000 + detail::I(value + 3) * 100 + detail::I(value + 5);
+                break;
+        }
+        for (const char* position = value + (stringLength & 7); currentDigit != digits; *--currentDigit = detail::I(position) * 1000000 + detail::I(position + 2) * 10000 + detail::I(position + 4) * 100 + detail::I(position + 6), position += 8);
+        for (; length > 1 && !digits[length - 1]; --length);
+    }
+
+    UnsignedInteger(const std::uint32_t* borrowedDigits, std::uint32_t borrowedLength, detail::BorrowedDigits* borrowed) noexcept : resource(borrowed), digits(const_cast<std::uint32_t*>(borrowedDigits)), length(borrowedLength), capacity(borrowedLength) {}
+
+    static std::uint8_t* writeSerializedHeader(std::uint8_t* destination, bool negative, std::uint32_t limbCount) noexcept {
+        std::memcpy(destination, detail::SerializedMagic, 4);
+        destination[4] = detail::SerializedVersion, destination[5] = std::uint8_t(negative), destination[6] = destination[7] = 0;
+        return detail::storeLittleEndian(destination + 8, &limbCount, 1), destination + detail::SerializedHeaderSize;
+    }
+
+    static UnsignedInteger loadSerialized(const std::uint8_t* data, std::uint32_t limbCount) {
+        if (!limbCount)
+            return UnsignedInteger();
+        UnsignedInteger result(limbCount, limbCount);
+        detail::loadLittleEndian(result.digits, data + detail::SerializedHeaderSize, limbCount);
+        VALIDITY_CHECK(std::all_of(result.digits, result.digits + limbCount, [](std::uint32_t digit) { return digit < Base; }), std::invalid_argument, "UnsignedInteger deserialize error: a limb is not below the base 100000000.")
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        return result;
+    }
+
+    static std::uint32_t readSerializedHeader(const std::uint8_t* data, std::size_t size, bool& negative) {
+        VALIDITY_CHECK(data && size >= detail::SerializedHeaderSize && !std::memcmp(data, detail::SerializedMagic, 4), std::invalid_argument, "UnsignedInteger deserialize error: the data does not start with a serialized integer header.")
+        if (!data || size < detail::SerializedHeaderSize)
+            return negative = false, 0;
+        VALIDITY_CHECK(data[4] == detail::SerializedVersion, std::invalid_argument, "UnsignedInteger deserialize error: unsupported format version " + std::to_string(data[4]) + ".")
+        VALIDITY_CHECK(data[5] <= 1 && !data[6] && !data[7], std::invalid_argument, "UnsignedInteger deserialize error: the header contains unknown flags.")
+        std::uint32_t limbCount;
+        detail::loadLittleEndian(&limbCount, data + 8, 1), negative = data[5];
+        VALIDITY_CHECK((size - detail::SerializedHeaderSize) >> 2 >= limbCount, std::invalid_argument, "UnsignedInteger deserialize error: the data holds fewer limbs than its header declares.")
+        return std::uint32_t(std::min<std::size_t>(limbCount, (size - detail::SerializedHeaderSize) >> 2));
+    }
+
+    char* writeLeadingDigit(char* position) const noexcept {
+        char buffer[8], *start = buffer + 8;
+        for (std::uint32_t number = length ? digits[length - 1] : 0; *--start = char(48 | number % 10), number /= 10;);
+        return std::memcpy(position, start, std::size_t(buffer + 8 - start)), position + (buffer + 8 - start);
+    }
+
+    static char* writeDigit(char* position, std::uint32_t digit) noexcept {
+        return std::memcpy(position, detail::O(digit / 10000), 4), std::memcpy(position + 4, detail::O(digit % 10000), 4), position + 8;
+    }
+
+    template <std::uint32_t Low>
+    static void realignDigits(std::uint32_t* target, std::uint32_t count) noexcept {
+        std::uint32_t first = 0, last = count - 1, previous = 0;
+        for (; first < last; ++first, --last) {
+            const std::uint32_t bottom = target[first];
+            target[first] = target[last] / Low + target[last - 1] % Low * (Base / Low);
+            target[last] = bottom / Low + previous % Low * (Base / Low), previous = bottom;
+        }
+        if (first == last)
+            target[first] = target[first] / Low + previous % Low * (Base / Low);
+    }
+
+    bool readDecimal(std::istream& stream) {
+        std::streambuf* source = stream.rdbuf();
+        int character = source->sgetc();
+        if (std::uint32_t(character - 48) >= 10)
+            return stream.setstate(character == std::char_traits<char>::eof() ? std::ios_base::eofbit | std::ios_base::failbit : std::ios_base::failbit), false;
+        std::uint32_t filled = 0, group = 0;
+        const auto push = [&](std::uint32_t digit) {
+            if (group = group * 10 + digit, ++filled == 8)
+                resize(length + 1), digits[length - 1] = group, filled = group = 0;
+        };
+        for (length = 0;;) {
+            const char *start = detail::StreamWindow::begin(source), *end = detail::StreamWindow::end(source), *position = start;
+            for (; position != end && filled && std::uint32_t(*position - 48) < 10; push(std::uint32_t(*position++ - 48)));
+            for (std::uint64_t word; end - position >= 8 && (std::memcpy(&word, position, 8), (word & 0xF0F0F0F0F0F0F0F0) == 0x3030303030303030 && ((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) == 0x3030303030303030); position += 8)
+                resize(length + 1), digits[length - 1] = detail::I(position) * 1000000 + detail::I(position + 2) * 10000 + detail::I(position + 4) * 100 + detail::I(position + 6);
+            for (; position != end && std::uint32_t(*position - 48) < 10; push(std::uint32_t(*position++ - 48)));
+            detail::StreamWindow::advance(source, position - start);
+            if (position != end)
+                break;
+            if ((character = source->sgetc()) == std::char_traits<char>::eof()) {
+                stream.setstate(std::ios_base::eofbit);
+                break;
+            }
+            if (detail::StreamWindow::begin(source) == detail::StreamWindow::end(source)) {
+                if (std::uint32_t(character - 48) >= 10)
+                    break;
+                push(std::uint32_t(character - 48)), source->sbumpc();
+            }
+        }
+        if (filled) {
+            resize(length + 1), digits[length - 1] = group * detail::DecimalPowers[8 - filled];
+            switch (filled) {
+                case 1: realignDigits<10000000>(digits, length); break;
+                case 2: realignDigits<1000000>(digits, length); break;
+                case 3: realignDigits<100000>(digits, length); break;
+                case 4: realignDigits<10000>(digits, length); break;
+                case 5: realignDigits<1000>(digits, length); break;
+                case 6: realignDigits<100>(digits, length); break;
+                case 7: realignDigits<10>(digits, length); break;
+            }
+        } else
+            std::reverse(digits, digits + length);
+        for (; length > 1 && !digits[length - 1]; --length);
+        return true;
+    }
+
+    void writeDecimal(std::ostream& stream, bool negative) const {
+        const std::ostream::sentry guard(stream);
+        if (!guard)
+            return;
+        const std::streamsize size = std::streamsize(decimalLength() + negative), width = stream.width();
+        const std::ios_base::fmtflags adjust = stream.flags() & std::ios_base::adjustfield;
+        std::streambuf* target = stream.rdbuf();
+        bool good = true;
+        const auto pad = [&](bool when) {
+            for (std::streamsize i = size; when && good && i < width; ++i)
+                good = target->sputc(stream.fill()) != std::char_traits<char>::eof();
+        };
+        stream.width(0), pad(adjust != std::ios_base::left && adjust != std::ios_base::internal);
+        if (negative && good)
+            good = target->sputc('-') != std::char_traits<char>::eof();
+        pad(adjust == std::ios_base::internal);
+        char chunk[1024];
+        char* position = writeLeadingDigit(chunk);
+        for (std::uint32_t i = length ? length - 1 : 0; good && i--;)
+            if ((position = writeDigit(position, digits[i])) + 8 > chunk + sizeof(chunk) || !i)
+                good = target->sputn(chunk, position - chunk) == position - chunk, position = chunk;
+        if (good && position != chunk)
+            good = target->sputn(chunk, position - chunk) == position - chunk;
+        pad(adjust == std::ios_base::left);
+        if (!good)
+            stream.setstate(std::ios_base::badbit);
+    }
+
+    static std::uint32_t addDigits(std::uint32_t* target, const std::uint32_t* source, std::uint32_t count) noexcept {
+        std::uint32_t carry = 0, i = 0;
+#if defined(__AVX2__)
+        const __m256i base = _mm256_set1_epi32(Base), limit = _mm256_set1_epi32(Base - 1), lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        for (; i + 8 <= count; i += 8) {
+            const __m256i sum = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)));
+            const std::uint32_t generate = std::uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(sum, limit)))), propagate = std::uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(sum, limit))));
+            const std::uint32_t carries = ((generate << 1) | carry) + propagate;
+            const __m256i incoming = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(std::int32_t((carries ^ propagate) & 255)), lanes), lanes), result = _mm256_sub_epi32(sum, incoming);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), _mm256_sub_epi32(result, _mm256_and_si256(_mm256_cmpgt_epi32(result, limit), base)));
+            carry = carries >> 8;
+        }
+#elif defined(__ARM_NEON__)
+        static const std::uint32_t laneBits[4] = {1, 2, 4, 8};
+        const uint32x4_t base = vdupq_n_u32(Base), limit = vdupq_n_u32(Base - 1), lanes = vld1q_u32(laneBits);
+        for (; i + 4 <= count; i += 4) {
+            const uint32x4_t sum = vaddq_u32(vld1q_u32(target + i), vld1q_u32(source + i));
+            const std::uint32_t generate = vaddvq_u32(vandq_u32(vcgtq_u32(sum, limit), lanes)), propagate = vaddvq_u32(vandq_u32(vceqq_u32(sum, limit), lanes));
+            const std::uint32_t carries = ((generate << 1) | carry) + propagate;
+            const uint32x4_t result = vsubq_u32(sum, vtstq_u32(vdupq_n_u32((carries ^ propagate) & 15), lanes));
+            vst1q_u32(target + i, vsubq_u32(result, vandq_u32(vcgtq_u32(result, limit), base)));
+            carry = carries >> 4;
+        }
+#endif
+        for (; i != count; ++i) {
+            const std::uint32_t sum = target[i] + source[i] + carry;
+            carry = sum >= Base, target[i] = carry ? sum - Base : sum;
+        }
+        return carry;
+    }
+
+    static std::uint32_t subtractDigits(std::uint32_t* target, const std::uint32_t* source, std::uint32_t count) noexcept {
+        std::uint32_t borrow = 0, i = 0;
+#if defined(__AVX2__)
+        const __m256i base = _mm256_set1_epi32(Base), zero = _mm256_setzero_si256(), lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        for (; i + 8 <= count; i += 8) {
+            const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i)), second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)), difference = _mm256_sub_epi32(first, second);
+            const std::uint32_t generate = std::uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(second, first)))), propagate = std::uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(first, second))));
+            const std::uint32_t borrows = ((generate << 1) | borrow) + propagate;
+            const __m256i incoming = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(std::int32_t((borrows ^ propagate) & 255)), lanes), lanes), result = _mm256_add_epi32(difference, incoming);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), _mm256_add_epi32(result, _mm256_and_si256(_mm256_cmpgt_epi32(zero, result), base)));
+            borrow = borrows >> 8;
+        }
+#elif defined(__ARM_NEON__)
+        static const std::uint32_t laneBits[4] = {1, 2, 4, 8};
+        const uint32x4_t base = vdupq_n_u32(Base), lanes = vld1q_u32(laneBits);
+        for (; i + 4 <= count; i += 4) {
+            const uint32x4_t first = vld1q_u32(target + i), second = vld1q_u32(source + i);
+            const std::uint32_t generate = vaddvq_u32(vandq_u32(vcltq_u32(first, second), lanes)), propagate = vaddvq_u32(vandq_u32(vceqq_u32(first, second), lanes));
+            const std::uint32_t borrows = ((generate << 1) | borrow) + propagate;
+            const uint32x4_t result = vaddq_u32(vsubq_u32(first, second), vtstq_u32(vdupq_n_u32((borrows ^ propagate) & 15), lanes));
+            vst1q_u32(target + i, vaddq_u32(result, vandq_u32(vcltzq_s32(vreinterpretq_s32_u32(result)), base)));
+            borrow = borrows >> 4;
+        }
+#endif
+        for (; i != count; ++i) {
+            const std::uint32_t difference = target[i] - source[i] - borrow;
+            borrow = difference >= Base, target[i] = borrow ? difference + Base : difference;
+        }
+        return borrow;
+    }
+
+    std::int32_t reverseCompare(const UnsignedInteger& other) const {
+        constexpr std::uint32_t BlockSize = 64;
+        const std::uint32_t remaining = length % BlockSize, *firstBlockPointer = digits + length - remaining, *secondBlockPointer = other.digits + length - remaining;
+        if (std::memcmp(firstBlockPointer, secondBlockPointer, remaining << 2))
+            for (const std::uint32_t *firstElementPointer = firstBlockPointer + remaining, *secondElementPointer = secondBlockPointer + remaining; firstElementPointer != firstBlockPointer;)
+                if (*--firstElementPointer != *--secondElementPointer)
+                    return std::int32_t(*firstElementPointer - *secondElementPointer);
+        while (firstBlockPointer != digits)
+            if (std::memcmp(firstBlockPointer -= BlockSize, secondBlockPointer -= BlockSize, BlockSize << 2))
+                for (const std::uint32_t *firstElementPointer = firstBlockPointer + BlockSize, *secondElementPointer = secondBlockPointer + BlockSize; firstElementPointer != firstBlockPointer;)
+                    if (*--firstElementPointer != *--secondElementPointer)
+                        return std::int32_t(*firstElementPointer - *secondElementPointer);
+        return 0;
+    }
+
+    // Writes into the existing buffers of quotient and remainder, growing them only when they are too small; neither may alias *this or divisor.
+    void bruteforceDivisionAndModulus(const UnsignedInteger& divisor, UnsignedInteger& quotient, UnsignedInteger& remainder) const {
+        INTEGER_PROFILE(BruteforceDivision, length);
+        if (*this < divisor) {
+            quotient = 0u, remainder = *this;
+            return;
+        }
+        if (divisor.length == 1) {
+            quotient = *this, remainder = quotient.divideScalar(divisor.digits[0]);
+            return;
+        }
+        const std::uint32_t divisorLength = divisor.length, quotientLength = length - divisorLength + 1, factor = Base / (divisor.digits[divisorLength - 1] + 1);
+        UnsignedInteger normalized(divisorLength, divisorLength);
+        quotient.reserveDiscarding(quotientLength), quotient.length = quotientLength;
+        remainder.reserveDiscarding(length + 1), remainder.length = length + 1;
+        std::uint64_t carry = 0;
+        for (std::uint32_t i = 0; i != length; ++i)
+            carry += std::uint64_t(digits[i]) * factor, remainder.digits[i] = std::uint32_t(carry % Base), carry /= Base;
+        remainder.digits[length] = std::uint32_t(carry), carry = 0;
+        for (std::uint32_t i = 0; i != divisorLength; ++i)
+            carry += std::uint64_t(divisor.digits[i]) * factor, normalized.digits[i] = std::uint32_t(carry % Base), carry /= Base;
+        const std::uint64_t top = normalized.digits[divisorLength - 1], next = normalized.digits[divisorLength - 2];
+        for (std::uint32_t j = quotientLength; j--;) {
+            std::uint32_t* window = remainder.digits + j;
+            const std::uint64_t leading = std::uint64_t(window[divisorLength]) * Base + window[divisorLength - 1];
+            std::uint64_t estimate = leading / top, rest = leading % top;
+            while (estimate >= Base || estimate * next > rest * Base + window[divisorLength - 2])
+                if (--estimate, (rest += top) >= Base)
+                    break;
+            std::uint64_t product = 0;
+            std::uint32_t borrow = 0;
+            for (std::uint32_t i = 0; i != divisorLength; ++i) {
+                product += estimate * normalized.digits[i];
+                const std::uint32_t difference = window[i] - std::uint32_t(product % Base) - borrow;
+                product /= Base, borrow = difference >= Base, window[i] = difference + (borrow ? Base : 0);
+            }
+            if ((window[divisorLength] -= std::uint32_t(product) + borrow) >= Base)
+                window[divisorLength] += addDigits(window, normalized.digits, divisorLength), --estimate;
+            quotient.digits[j] = std::uint32_t(estimate);
+        }
+        remainder.length = divisorLength;
+        for (std::uint32_t i = divisorLength; i--;)
+            carry = carry * Base + remainder.digits[i], remainder.digits[i] = std::uint32_t(carry / factor), carry %= factor;
+        for (; quotient.length > 1 && !quotient.digits[quotient.length - 1]; --quotient.length);
+        for (; remainder.length > 1 && !remainder.digits[remainder.length - 1]; --remainder.length);
+    }
+
+    std::pair<UnsignedInteger, UnsignedInteger> bruteforceDivisionAndModulus(const UnsignedInteger& divisor) const {
+        std::pair<UnsignedInteger, UnsignedInteger> result;
+        bruteforceDivisionAndModulus(divisor, result.first, result.second);
+        return result;
+    }
+
+    UnsignedInteger rightShift(std::uint32_t shiftAmount) const {
+        if (shiftAmount >= length)
+            return UnsignedInteger();
+        UnsignedInteger result(length - shiftAmount, length - shiftAmount);
+        std::memcpy(result.digits, digits + shiftAmount, result.length << 2);
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        return result;
+    }
+
+    UnsignedInteger leftShift(std::uint32_t shiftAmount) const {
+        if (length == 0 || shiftAmount == 0)
+            return *this;
+        UnsignedInteger result(length + shiftAmount, length + shiftAmount);
+        std::memset(result.digits, 0, shiftAmount << 2), std::memcpy(result.digits + shiftAmount, digits, length << 2);
+        return result;
+    }
+
+    UnsignedInteger lowerDigits(std::uint32_t digitCount) const {
+        if (digitCount >= length)
+            return *this;
+        UnsignedInteger result(digitCount, digitCount);
+        std::memcpy(result.digits, digits, digitCount << 2);
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        return result;
+    }
+
+    UnsignedInteger copyWithCapacity(std::uint32_t extraCapacity) const {
+        UnsignedInteger result(length, length + extraCapacity);
+        std::memcpy(result.digits, digits, length << 2);
+        return result;
+    }
+
+    // *this = other - *this in place; requires other >= *this.
+    UnsignedInteger& reverseSubtract(const UnsignedInteger& other) {
+        VALIDITY_CHECK(
+            other >= *this,
+            std::invalid_argument,
+            std::string("UnsignedInteger subtraction error: attempted to subtract a larger UnsignedInteger ") +
+                this->operator std::string() +
+                " from a smaller one " +
+                other.operator std::string() +
+                ".")
+        const std::uint32_t oldLength = length;
+        if (length < other.length)
+            resize(other.length), std::memset(digits + oldLength, 0, (length - oldLength) << 2);
+        for (std::uint32_t i = 0, borrow = 0; i != length; ++i) {
+            const std::uint32_t difference = other.digits[i] - digits[i] - borrow;
+            borrow = difference >= Base, digits[i] = borrow ? difference + Base : difference;
+        }
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    static std::uint32_t splitScalar(std::uint64_t value, std::uint32_t* valueDigits) {
+        std::uint32_t valueLength = 0;
+        do
+            valueDigits[valueLength++] = std::uint32_t(value % Base);
+        while (value /= Base);
+        return valueLength;
+    }
+
+    int compareScalar(std::uint64_t value) const {
+        std::uint32_t valueDigits[3];
+        const std::uint32_t valueLength = splitScalar(value, valueDigits);
+        if (length != valueLength)
+            return length < valueLength ? -1 : 1;
+        for (std::uint32_t i = length; i--;)
+            if (digits[i] != valueDigits[i])
+                return digits[i] < valueDigits[i] ? -1 : 1;
+        return 0;
+    }
+
+    UnsignedInteger& addScalar(std::uint64_t value) {
+        for (std::uint32_t i = 0; value && i != length; ++i) {
+            const std::uint64_t sum = value % Base + digits[i];
+            digits[i] = std::uint32_t(sum % Base), value = value / Base + sum / Base;
+        }
+        for (; value; value /= Base)
+            resize(length + 1), digits[length - 1] = std::uint32_t(value % Base);
+        return *this;
+    }
+
+    UnsignedInteger& subtractScalar(std::uint64_t value) {
+        for (std::uint32_t i = 0; value; ++i) {
+            const std::uint32_t subtrahend = std::uint32_t(value % Base);
+            value /= Base;
+            if (digits[i] >= subtrahend)
+                digits[i] -= subtrahend;
+            else
+                digits[i] += Base - subtrahend, ++value;
+        }
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    UnsignedInteger& multiplyScalar(std::uint64_t value) {
+        std::uint32_t valueDigits[3] = {};
+        const std::uint32_t valueLength = splitScalar(value, valueDigits), oldLength = length;
+        std::uint64_t carry = 0;
+        if (valueLength == 1) {
+            for (std::uint32_t i = 0; i != length; ++i)
+                carry += std::uint64_t(digits[i]) * valueDigits[0], digits[i] = std::uint32_t(carry % Base), carry /= Base;
+            if (carry)
+                resize(length + 1), digits[length - 1] = std::uint32_t(carry);
+        } else {
+            resize(length + valueLength);
+            for (std::uint32_t i = 0, previous = 0, beforePrevious = 0; i != length; ++i) {
+                const std::uint32_t current = i < oldLength ? digits[i] : 0;
+                carry += std::uint64_t(current) * valueDigits[0] + std::uint64_t(previous) * valueDigits[1] + std::uint64_t(beforePrevious) * valueDigits[2];
+                digits[i] = std::uint32_t(carry % Base), carry /= Base, beforePrevious = previous, previous = current;
+            }
+        }
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    std::uint64_t divideScalar(std::uint64_t value) {
+        if (value > std::numeric_limits<std::uint64_t>::max() / Base) {
+            std::pair<UnsignedInteger, UnsignedInteger> result = divisionAndModulus(UnsignedInteger(value));
+            return *this = std::move(result.first), std::uint64_t(result.second);
+        }
+        std::uint64_t remainder = 0;
+        for (std::uint32_t i = length; i--;)
+            remainder = remainder * Base + digits[i], digits[i] = std::uint32_t(remainder / value), remainder %= value;
+        for (; length > 1 && !digits[length - 1]; --length);
+        return remainder;
+    }
+
+    std::uint64_t remainderScalar(std::uint64_t value) const {
+        if (value > std::numeric_limits<std::uint64_t>::max() / Base)
+            return std::uint64_t(divisionAndModulus(UnsignedInteger(value)).second);
+        std::uint64_t remainder = 0;
+        for (std::uint32_t i = length; i--; remainder = (remainder * Base + digits[i]) % value);
+        return remainder;
+    }
+
+    std::vector<std::uint32_t> binaryWords() const {
+        std::vector<std::uint32_t> words, remaining(digits, digits + length);
+        for (std::uint32_t remainingLength = length; remainingLength > 1 || remaining[0];) {
+            std::uint64_t remainder = 0;
+            for (std::uint32_t i = remainingLength; i--;)
+                remainder = remainder * Base + remaining[i], remaining[i] = std::uint32_t(remainder >> 32), remainder &= 0xffffffffu;
+            words.push_back(std::uint32_t(remainder));
+            for (; remainingLength > 1 && !remaining[remainingLength - 1]; --remainingLength);
+        }
+        return words;
+    }
+
+    std::int32_t radixLevel(detail::RadixPowers& powers) const;
+
+    void appendRadixDigits(const detail::RadixPowers& powers, std::int32_t level, std::uint32_t width, std::string& output) const;
+
+    static UnsignedInteger parseRadixDigits(detail::RadixPowers& powers, const char* values, std::uint32_t count);
+
+    template <typename Reduction>
+    static UnsignedInteger slidingWindowPower(const UnsignedInteger& base, const UnsignedInteger& exponent, Reduction reduction) {
+        const std::vector<std::uint32_t> exponentWords = exponent.binaryWords();
+        UnsignedInteger result(1u);
+        if (exponentWords.empty())
+            return reduction(result), result;
+        const std::uint32_t bitLength = (std::uint32_t(exponentWords.size()) << 5) - __builtin_clz(exponentWords.back());
+        const std::uint32_t windowSize = bitLength > 671 ? 6 : bitLength > 239 ? 5 : bitLength > 79 ? 4 : bitLength > 23 ? 3 : bitLength > 7 ? 2 : 1;
+        auto exponentBit = [&](std::uint32_t bit) -> std::uint32_t { return exponentWords[bit >> 5] >> (bit & 31) & 1; };
+        std::vector<UnsignedInteger> oddPowers(std::size_t(1) << (windowSize - 1), base);
+        reduction(oddPowers[0]);
+        if (windowSize > 1) {
+            UnsignedInteger baseSquare = oddPowers[0];
+            reduction(baseSquare.square());
+            for (std::size_t i = 1; i != oddPowers.size(); ++i)
+                reduction(oddPowers[i] = oddPowers[i - 1] * baseSquare);
+        }
+        bool started = false;
+        for (std::uint32_t bit = bitLength; bit;) {
+            if (!exponentBit(bit - 1)) {
+                reduction(result.square()), --bit;
+                continue;
+            }
+            std::uint32_t windowEnd = bit > windowSize ? bit - windowSize : 0, windowValue = 0;
+            for (; !exponentBit(windowEnd); ++windowEnd);
+            for (std::uint32_t i = bit; i-- != windowEnd; windowValue = windowValue << 1 | exponentBit(i))
+                if (started)
+                    reduction(result.square());
+            if (started)
+                reduction(result *= oddPowers[windowValue >> 1]);
+            else
+                result = oddPowers[windowValue >> 1], started = true;
+            bit = windowEnd;
+        }
+        return result;
+    }
+
+    UnsignedInteger bruteforceMultiply(const UnsignedInteger& other, const UnsignedInteger* addend = nullptr) const {
+        INTEGER_PROFILE(BruteforceMultiply, length + other.length);
+        const std::uint32_t addendLength = addend ? addend->length : 0, resultLength = std::max(length + other.length - 1, addendLength);
+        UnsignedInteger result(resultLength, resultLength + 1);
+        std::uint64_t carry = 0;
+        for (std::uint32_t i = 0; i != result.length; result.digits[i++] = std::uint32_t(carry % Base), carry /= Base) {
+            if (i < addendLength)
+                carry += addend->digits[i];
+            for (std::uint32_t j = (i >= length ? i - length + 1 : 0); j <= i && j < other.length; ++j)
+                carry += std::uint64_t(digits[i - j]) * other.digits[j];
+        }
+        if (carry)
+            result.digits[result.length] = std::uint32_t(carry), ++result.length;
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        return result;
+    }
+
+    UnsignedInteger bruteforceSquare(const UnsignedInteger* addend = nullptr) const {
+        INTEGER_PROFILE(BruteforceSquare, length << 1);
+        const std::uint32_t addendLength = addend ? addend->length : 0, resultLength = std::max(2 * length - 1, addendLength);
+        UnsignedInteger result(resultLength, resultLength + 1);
+        std::uint64_t carry = 0;
+        for (std::uint32_t i = 0; i != result.length; result.digits[i++] = std::uint32_t(carry % Base), carry /= Base) {
+            std::uint64_t crossTerms = 0;
+            if (i < addendLength)
+                carry += addend->digits[i];
+            for (std::uint32_t j = (i >= length ? i - length + 1 : 0); j < i - j; ++j)
+                crossTerms += std::uint64_t(digits[j]) * digits[i - j];
+            carry += crossTerms << 1;
+            if (!(i & 1) && (i >> 1) < length)
+                carry += std::uint64_t(digits[i >> 1]) * digits[i >> 1];
+        }
+        if (carry)
+            result.digits[result.length] = std::uint32_t(carry), ++result.length;
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        return result;
+    }
+
+    std::uint32_t transformLayout(const UnsignedInteger& other, bool& wrapAround) const {
+        const std::uint32_t resultLength = length + other.length, paddedLength = other.length > length ? 2u << detail::log2(resultLength - 1) : std::min(2u << detail::log2(resultLength - 1), 2u << detail::log2(UnbalancedRatio * other.length - 1)), wrappedLength = resultLength - (paddedLength >> 1);
+        wrapAround = paddedLength >= resultLength && wrappedLength <= std::min(length, other.length) && wrappedLength <= (paddedLength >> 1) / WrapAroundRatio;
+        return wrapAround ? paddedLength >> 1 : paddedLength;
+    }
+
+    static std::uint32_t transformTasks(const IntegerExecutor* executor, std::uint32_t transformLength) {
+        if (!executor || transformLength < ParallelTransformThreshold || executor->concurrency() < 2)
+            return 1;
+        return std::min(4u << detail::log2(executor->concurrency() - 1), transformLength / ParallelTransformGrain);
+    }
+
+    static void splitDigits(detail::TransformHelper::Complex* dataArray, const std::uint32_t* sourceDigits, std::uint32_t sourceLength, std::uint32_t transformLength, IntegerExecutor* executor, std::uint32_t taskCount) {
+        detail::parallelFor(executor, taskCount, transformLength, [&](std::uint32_t begin, std::uint32_t end, std::uint32_t) {
+            for (std::uint32_t i = begin; i < end && i < sourceLength; ++i)
+                dataArray[i] = detail::TransformHelper::splitDigit(sourceDigits[i]);
+            if (end > sourceLength) {
+                INTEGER_PROFILE(ScratchClear, end - std::max(begin, sourceLength));
+                std::memset(static_cast<void*>(dataArray + std::max(begin, sourceLength)), 0, (end - std::max(begin, sourceLength)) * sizeof(detail::TransformHelper::Complex));
+            }
+        });
+    }
+
+    static std::uint64_t mergeDigits(std::uint32_t* resultDigits, const detail::TransformHelper::Complex* dataArray, std::uint32_t mergeLength, std::uint64_t carry, IntegerExecutor* executor, std::uint32_t taskCount) {
+        if (taskCount < 2) {
+            for (std::uint32_t i = 0; i != mergeLength; ++i)
+                carry += detail::TransformHelper::mergeDigit(dataArray[i]) + resultDigits[i], resultDigits[i] = std::uint32_t(carry % Base), carry /= Base;
+            return carry;
+        }
+        std::vector<std::uint64_t> blockCarries(taskCount);
+        std::vector<std::uint32_t> blockStarts(taskCount);
+        detail::parallelFor(executor, taskCount, mergeLength, [&](std::uint32_t begin, std::uint32_t end, std::uint32_t task) {
+            std::uint64_t blockCarry = 0;
+            for (std::uint32_t i = begin; i != end; ++i)
+                blockCarry += detail::TransformHelper::mergeDigit(dataArray[i]) + resultDigits[i], resultDigits[i] = std::uint32_t(blockCarry % Base), blockCarry /= Base;
+            blockCarries[task] = blockCarry, blockStarts[task] = begin;
+        });
+        std::uint64_t overflow = 0;
+        for (std::uint32_t task = 0; task != taskCount; carry += blockCarries[task++]) {
+            std::uint32_t i = blockStarts[task];
+            for (; carry && i != mergeLength; ++i)
+                carry += resultDigits[i], resultDigits[i] = std::uint32_t(carry % Base), carry /= Base;
+            if (i == mergeLength)
+                overflow += carry, carry = 0;
+        }
+        return carry + overflow;
+    }
+
+    void forwardTransform(detail::TransformHelper::Complex* dataArray, std::uint32_t transformLength) const {
+        IntegerExecutor* executor = IntegerExecutor::current();
+        const std::uint32_t taskCount = transformTasks(executor, transformLength);
+        splitDigits(dataArray, digits, length, transformLength, executor, taskCount);
+        detail::T.resize(transformLength), detail::decimationInFrequency(detail::T, dataArray, transformLength, executor, taskCount);
+    }
+
+    UnsignedInteger transformMultiply(const UnsignedInteger& other, const detail::TransformHelper::Complex* otherImage, std::uint32_t transformLength, bool wrapAround, const UnsignedInteger* addend = nullptr) const {
+        INTEGER_PROFILE(TransformMultiply, length + other.length);
+        using Complex = detail::TransformHelper::Complex;
+        const std::uint32_t resultLength = length + other.length, wrappedLength = resultLength - transformLength, chunkLength = wrapAround ? length : transformLength - other.length;
+        const bool foldAddend = addend && !wrapAround && addend->length <= resultLength;
+        Complex* firstArray = detail::TransformBuffers[0].reserve<Complex>(transformLength);
+        detail::T.resize(transformLength);
+        IntegerExecutor* executor = IntegerExecutor::current();
+        const std::uint32_t taskCount = transformTasks(executor, transformLength);
+        UnsignedInteger result(resultLength + foldAddend, resultLength + foldAddend);
+        {
+            INTEGER_PROFILE(ScratchClear, result.length);
+            std::memset(result.digits, 0, result.length << 2);
+        }
+        if (foldAddend)
+            std::memcpy(result.digits, addend->digits, addend->length << 2);
+        std::uint64_t carry = 0;
+        for (std::uint32_t offset = 0; offset < length; offset += chunkLength) {
+            const std::uint32_t pieceLength = std::min(chunkLength, length - offset), mergeLength = std::min(pieceLength + other.length, transformLength);
+            splitDigits(firstArray, digits + offset, pieceLength, transformLength, executor, taskCount);
+            detail::decimationInFrequency(detail::T, firstArray, transformLength, executor, taskCount);
+            detail::frequencyDomainPointwiseMultiply(detail::T, firstArray, otherImage, transformLength, executor, taskCount);
+            detail::decimationInTime(detail::T, firstArray, transformLength, executor, taskCount);
+            carry = mergeDigits(result.digits + offset, firstArray, mergeLength, carry, executor, taskCount);
+            for (std::uint32_t* resultDigit = result.digits + offset + mergeLength; foldAddend && carry; ++resultDigit)
+                carry += *resultDigit, *resultDigit = std::uint32_t(carry % Base), carry /= Base;
+        }
+        if (wrapAround) {
+            for (std::uint32_t i = 0; carry; i = i + 1 == transformLength ? 0 : i + 1)
+                carry += result.digits[i], result.digits[i] = std::uint32_t(carry % Base), carry /= Base;
+            UnsignedInteger lowProduct = lowerDigits(wrappedLength);
+            if (&other == this)
+                lowProduct.square();
+            else
+                lowProduct *= other.lowerDigits(wrappedLength);
+            const std::uint32_t lowLength = std::min(lowProduct.length, wrappedLength);
+            std::memcpy(result.digits + transformLength, result.digits, wrappedLength << 2);
+            std::uint32_t borrow = subtractDigits(result.digits + transformLength, lowProduct.digits, lowLength);
+            for (std::uint32_t i = transformLength + lowLength; borrow && i != transformLength + wrappedLength; ++i)
+                borrow = !result.digits[i], result.digits[i] = borrow ? Base - 1 : result.digits[i] - 1;
+            borrow = subtractDigits(result.digits, result.digits + transformLength, wrappedLength);
+            for (std::uint32_t i = wrappedLength; borrow; ++i)
+                borrow = !result.digits[i], result.digits[i] = borrow ? Base - 1 : result.digits[i] - 1;
+        }
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        if (addend && !foldAddend)
+            result += *addend;
+        return result;
+    }
+
+    UnsignedInteger transformMultiply(const UnsignedInteger& other, const UnsignedInteger* addend = nullptr) const {
+        if (other.length > length)
+            return other.transformMultiply(*this, addend);
+        bool wrapAround;
+        const std::uint32_t transformLength = transformLayout(other, wrapAround);
+        if (&other == this)
+            return transformMultiply(other, nullptr, transformLength, wrapAround, addend);
+        detail::TransformHelper::Complex* secondArray = detail::TransformBuffers[1].reserve<detail::TransformHelper::Complex>(transformLength);
+        other.forwardTransform(secondArray, transformLength);
+        return transformMultiply(other, secondArray, transformLength, wrapAround, addend);
+    }
+
+    // Serial body of multiplyBatch. The transform buffers and twiddle table are sized once for the largest transform in the run, and a pair whose
+    // smaller operand equals the previous pair's (with the same layout) reuses that operand's forward image. Reuse is decided before any result
+    // is written, so result may alias the inputs.
+    static void multiplyRun(const UnsignedInteger* first, const UnsignedInteger* second, UnsignedInteger* result, std::uint32_t count) {
+        using Complex = detail::TransformHelper::Complex;
+        std::vector<std::uint32_t> layouts(count);
+        std::vector<bool> wrapArounds(count), reused(count);
+        std::uint32_t largest = 0;
+        for (std::uint32_t i = 0; i != count; ++i) {
+            const UnsignedInteger &larger = first[i].length >= second[i].length ? first[i] : second[i], &smaller = &larger == first + i ? second[i] : first[i];
+            if (&larger == &smaller || larger.multiplyTier(smaller) != MultiplyTier::Transform)
+                continue;
+            bool wrapAround;
+            layouts[i] = larger.transformLayout(smaller, wrapAround), wrapArounds[i] = wrapAround, largest = std::max(largest, layouts[i]);
+            if (i && layouts[i - 1] == layouts[i] && !wrapArounds[i - 1]) {
+                const UnsignedInteger& previous = first[i - 1].length >= second[i - 1].length ? second[i - 1] : first[i - 1];
+                reused[i] = &previous == &smaller || previous == smaller;
+            }
+        }
+        if (largest)
+            detail::T.resize(largest), detail::TransformBuffers[0].reserve<Complex>(largest), detail::TransformBuffers[1].reserve<Complex>(largest);
+        Complex* image = detail::TransformBuffers[1].reserve<Complex>(largest);
+        for (std::uint32_t i = 0; i != count; ++i) {
+            if (!layouts[i]) {
+                result[i] = first[i].product(second[i]);
+                continue;
+            }
+            const UnsignedInteger &larger = first[i].length >= second[i].length ? first[i] : second[i], &smaller = &larger == first + i ? second[i] : first[i];
+            if (!reused[i])
+                smaller.forwardTransform(image, layouts[i]);
+            result[i] = larger.transformMultiply(smaller, image, layouts[i], wrapArounds[i]);
+        }
+    }
+
+    template <typename ModularHelper>
+    void modularConvolution(ModularHelper& helper, const UnsignedInteger& other, std::uint32_t* residueArray, std::uint32_t* scratchArray, std::uint32_t transformLength) const {
+        {
+            INTEGER_PROFILE(ScratchClear, transformLength);
+            std::memcpy(residueArray, digits, length << 2), std::memset(residueArray + length, 0, (transformLength - length) << 2);
+        }
+        helper.resize(transformLength), helper.decimationInFrequency(residueArray, transformLength);
+        if (&other == this)
+            helper.frequencyDomainPointwiseMultiply(residueArray, residueArray, transformLength);
+        else {
+            {
+                INTEGER_PROFILE(ScratchClear, transformLength);
+                std::memcpy(scratchArray, other.digits, other.length << 2), std::memset(scratchArray + other.length, 0, (transformLength - other.length) << 2);
+            }
+            helper.decimationInFrequency(scratchArray, transformLength), helper.frequencyDomainPointwiseMultiply(residueArray, scratchArray, transformLength);
+        }
+        helper.decimationInTime(residueArray, transformLength);
+    }
+
+    UnsignedInteger modularTransformMultiply(const UnsignedInteger& other, const UnsignedInteger* addend = nullptr) const {
+        INTEGER_PROFILE(ModularTransformMultiply, length + other.length);
+        constexpr std::uint64_t FirstModulus = 2013265921, SecondModulus = 1811939329, ThirdModulus = 469762049;
+        constexpr std::uint64_t FirstInverse = 1811939320, SecondInverse = 60252089;
+        constexpr std::uint64_t ModulusProduct = FirstModulus * SecondModulus, ProductDigits[3] = {ModulusProduct % Base, ModulusProduct / Base % Base, ModulusProduct / Base / Base};
+        const std::uint32_t resultLength = length + other.length, transformLength = 2u << detail::log2(resultLength - 1);
+        VALIDITY_CHECK(transformLength <= ModularTransformLimit, std::invalid_argument, "UnsignedInteger multiplication error: result length (" + std::to_string(resultLength) + ") exceeds modular Transform limit (" + std::to_string(ModularTransformLimit) + ").")
+        std::uint32_t *firstArray = detail::ModularBuffers[0].reserve<std::uint32_t>(transformLength), *secondArray = detail::ModularBuffers[1].reserve<std::uint32_t>(transformLength), *thirdArray = detail::ModularBuffers[2].reserve<std::uint32_t>(transformLength), *scratchArray = detail::ModularBuffers[3].reserve<std::uint32_t>(transformLength);
+        modularConvolution(detail::M0, other, firstArray, scratchArray, transformLength);
+        modularConvolution(detail::M1, other, secondArray, scratchArray, transformLength);
+        modularConvolution(detail::M2, other, thirdArray, scratchArray, transformLength);
+        const bool foldAddend = addend && addend->length <= resultLength;
+        UnsignedInteger result(resultLength + foldAddend, resultLength + foldAddend);
+        std::uint64_t current = 0, next = 0, afterNext = 0;
+        for (std::uint32_t i = 0; i != resultLength; ++i) {
+            if (foldAddend && i < addend->length)
+                current += addend->digits[i];
+            const std::uint64_t firstResidue = firstArray[i], secondResidue = secondArray[i], thirdResidue = thirdArray[i];
+            const std::uint64_t partial = firstResidue + FirstModulus * ((secondResidue + SecondModulus - firstResidue % SecondModulus) * FirstInverse % SecondModulus);
+            const std::uint64_t multiplier = (thirdResidue + ThirdModulus - partial % ThirdModulus) * SecondInverse % ThirdModulus;
+            current += partial % Base + multiplier * ProductDigits[0], next += partial / Base % Base + multiplier * ProductDigits[1], afterNext += partial / Base / Base + multiplier * ProductDigits[2];
+            result.digits[i] = std::uint32_t(current % Base), current = current / Base + next, next = afterNext, afterNext = 0;
+        }
+        if (foldAddend)
+            result.digits[resultLength] = std::uint32_t(current);
+        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+        if (addend && !foldAddend)
+            result += *addend;
+        return result;
+    }
+
+    enum class MultiplyTier { Bruteforce, Transform, ModularTransform };
+
+    // The one place the multiplication crossovers are decided; &other == this selects the squaring thresholds.
+    MultiplyTier multiplyTier(const UnsignedInteger& other) const noexcept {
+        if (&other == this)
+            return length < SquareThreshold ? MultiplyTier::Bruteforce : length > TransformLimit ? MultiplyTier::ModularTransform : MultiplyTier::Transform;
+        if (length < MultiplyThreshold || other.length < MultiplyThreshold || length + other.length < MultiplyLengthThreshold)
+            return MultiplyTier::Bruteforce;
+        if ((length > TransformLimit || other.length > TransformLimit) && std::min(length, other.length) > TransformLimit / UnbalancedRatio)
+            return MultiplyTier::ModularTransform;
+        return MultiplyTier::Transform;
+    }
+
+    UnsignedInteger product(const UnsignedInteger& other, const UnsignedInteger* addend = nullptr) const {
+        const MultiplyTier tier = multiplyTier(other);
+        if (tier == MultiplyTier::Bruteforce)
+            return &other == this ? bruteforceSquare(addend) : bruteforceMultiply(other, addend);
+        if (tier == MultiplyTier::ModularTransform)
+            return modularTransformMultiply(other, addend);
+        return transformMultiply(other, addend);
+    }
+
+    static void wrapCarry(std::uint32_t* digitArray, std::uint32_t cycleLength, std::uint64_t carry, std::uint32_t position = 0) noexcept {
+        for (std::uint32_t i = position; carry; i = i + 1 == cycleLength ? 0 : i + 1)
+            carry += digitArray[i], digitArray[i] = std::uint32_t(carry % Base), carry /= Base;
+    }
+
+    UnsignedInteger& normalizeCycle(std::uint32_t cycleLength) {
+        for (; length > 1 && !digits[length - 1]; --length);
+        if (length == cycleLength && std::all_of(digits, digits + length, [](std::uint32_t digit) { return digit == Base - 1; }))
+            length = 1, *digits = 0;
+        return *this;
+    }
+
+    // Residue modulo Base^cycleLength - 1.
+    UnsignedInteger cyclicFold(std::uint32_t cycleLength) const {
+        if (length <= cycleLength)
+            return UnsignedInteger(*this).normalizeCycle(cycleLength);
+        UnsignedInteger result(cycleLength, cycleLength);
+        std::memcpy(result.digits, digits, cycleLength << 2);
+        for (std::uint32_t offset = cycleLength, count; offset < length; offset += cycleLength)
+            count = std::min(cycleLength, length - offset), wrapCarry(result.digits, cycleLength, addDigits(result.digits, digits + offset, count), count & (cycleLength - 1));
+        return result.normalizeCycle(cycleLength);
+    }
+
+    UnsignedInteger cyclicComplement(std::uint32_t cycleLength) const {
+        UnsignedInteger result(cycleLength, cycleLength);
+        for (std::uint32_t i = 0; i != cycleLength; ++i)
+            result.digits[i] = Base - 1 - (i < length ? digits[i] : 0);
+        return result.normalizeCycle(cycleLength);
+    }
+
+    // Product modulo Base^cycleLength - 1 for a power-of-two cycleLength: the transform is run cyclically instead of zero-padded to the full product length.
+    UnsignedInteger cyclicProduct(const UnsignedInteger& other, std::uint32_t cycleLength) const {
+        if (length > cycleLength || other.length > cycleLength)
+            return cyclicFold(cycleLength).cyclicProduct(other.cyclicFold(cycleLength), cycleLength);
+        if (length + other.length <= cycleLength || length < MultiplyThreshold || other.length < MultiplyThreshold || cycleLength > TransformLimit)
+            return product(other).cyclicFold(cycleLength);
+        INTEGER_PROFILE(TransformMultiply, cycleLength);
+        using Complex = detail::TransformHelper::Complex;
+        Complex *firstArray = detail::TransformBuffers[0].reserve<Complex>(cycleLength), *secondArray = detail::TransformBuffers[1].reserve<Complex>(cycleLength);
+        IntegerExecutor* executor = IntegerExecutor::current();
+        const std::uint32_t taskCount = transformTasks(executor, cycleLength);
+        forwardTransform(firstArray, cycleLength), other.forwardTransform(secondArray, cycleLength);
+        detail::frequencyDomainPointwiseMultiply(detail::T, firstArray, secondArray, cycleLength, executor, taskCount);
+        detail::decimationInTime(detail::T, firstArray, cycleLength, executor, taskCount);
+        UnsignedInteger result(cycleLength, cycleLength);
+        {
+            INTEGER_PROFILE(ScratchClear, cycleLength);
+            std::memset(result.digits, 0, cycleLength << 2);
+        }
+        wrapCarry(result.digits, cycleLength, mergeDigits(result.digits, firstArray, cycleLength, 0, executor, taskCount));
+        return result.normalizeCycle(cycleLength);
+    }
+
+    // Recovers first - second from residues modulo Base^cycleLength - 1, given that the true difference is below Base^(cycleLength - 1) in magnitude.
+    static UnsignedInteger cyclicDifference(UnsignedInteger first, const UnsignedInteger& second, std::uint32_t cycleLength, bool& negative) {
+        negative = first < second;
+        if (negative)
+            first = second - first;
+        else
+            first -= second;
+        if (first.length == cycleLength)
+            first = first.cyclicComplement(cycleLength), negative = !negative;
+        negative = negative && bool(first);
+        return first;
+    }
+
+    UnsignedInteger computeInverse(std::uint32_t precisionBits) const {
+        INTEGER_PROFILE(NewtonInverse, precisionBits);
+        if (length < BruteforceThreshold || precisionBits < length + BruteforceThreshold) {
+            UnsignedInteger numerator(precisionBits + 1, precisionBits + 1);
+            std::memset(numerator.digits, 0, precisionBits << 2), numerator.digits[precisionBits] = 1;
+            return numerator.bruteforceDivisionAndModulus(*this).first;
+        }
+        const std::uint32_t halfPrecision = (precisionBits - length + 5) >> 1, shiftBack = halfPrecision > length ? 0 : length - halfPrecision;
+        UnsignedInteger truncated = rightShift(shiftBack);
+        const std::uint32_t newPrecision = halfPrecision + truncated.length;
+        UnsignedInteger approximateInverse = truncated.computeInverse(newPrecision);
+        // With x = approximateInverse and W = newPrecision + shiftBack, the error E = Base^W - *this * x stays below 2 Base^(length + 1), so it is recovered from a cyclic product of just over length limbs.
+        const std::uint32_t scale = newPrecision + shiftBack, cycleLength = 2u << detail::log2(length + 2), correctionShift = 2 * scale - precisionBits;
+        UnsignedInteger power(cycleLength, cycleLength);
+        std::memset(power.digits, 0, cycleLength << 2), power.digits[scale & (cycleLength - 1)] = 1, power.normalizeCycle(cycleLength);
+        bool negative;
+        UnsignedInteger error = cyclicDifference(std::move(power), cyclicProduct(approximateInverse, cycleLength), cycleLength, negative);
+        const std::uint32_t dropped = correctionShift > approximateInverse.length + 1 ? correctionShift - approximateInverse.length - 1 : 0;
+        UnsignedInteger correction = approximateInverse.product(error.rightShift(dropped)).rightShift(correctionShift - dropped);
+        UnsignedInteger result = approximateInverse.leftShift(precisionBits - scale);
+        if (negative)
+            result -= correction.addScalar(1);
+        else
+            result += correction;
+        return --result;
+    }
+
+    std::pair<UnsignedInteger, UnsignedInteger> divisionAndModulus(const UnsignedInteger& other) const;
+
+    std::pair<UnsignedInteger, UnsignedInteger> bruteforceSqrtRem() const {
+        UnsignedInteger root(std::sqrt(double(*this)));
+        for (; root.product(root) > *this; --root);
+        UnsignedInteger remainder = *this - root.product(root);
+        for (UnsignedInteger doubled = UnsignedInteger(root).multiplyScalar(2); remainder > doubled; remainder -= ++doubled, ++doubled, ++root);
+        return std::make_pair(std::move(root), std::move(remainder));
+    }
+
+    // Karatsuba square root: requires an even length and a leading limb of at least Base / 4.
+    std::pair<UnsignedInteger, UnsignedInteger> normalizedSqrtRem() const {
+        if (length <= SqrtBruteforceThreshold)
+            return bruteforceSqrtRem();
+        const std::uint32_t lowLength = length >> 2;
+        std::pair<UnsignedInteger, UnsignedInteger> high = rightShift(lowLength << 1).normalizedSqrtRem();
+        UnsignedInteger numerator = high.second.leftShift(lowLength);
+        std::memcpy(numerator.digits, digits + lowLength, lowLength << 2);
+        for (; numerator.length > 1 && !numerator.digits[numerator.length - 1]; --numerator.length);
+        std::pair<UnsignedInteger, UnsignedInteger> step = numerator.divisionAndModulus(UnsignedInteger(high.first).multiplyScalar(2));
+        UnsignedInteger root = high.first.leftShift(lowLength), remainder = step.second.leftShift(lowLength);
+        std::memcpy(remainder.digits, digits, lowLength << 2);
+        for (; remainder.length > 1 && !remainder.digits[remainder.length - 1]; --remainder.length);
+        const UnsignedInteger correction = step.first.product(step.first);
+        root += step.first;
+        if (remainder < correction)
+            remainder += root, remainder += --root;
+        return std::make_pair(std::move(root), std::move(remainder -= correction));
+    }
+
+    std::pair<UnsignedInteger, UnsignedInteger> sqrtRemainder(bool exactRemainder) const {
+        if (length <= SqrtBruteforceThreshold)
+            return bruteforceSqrtRem();
+        const std::uint32_t targetLength = (length + 1) & ~1u;
+        const double exponent = ((targetLength - length + 2) * std::log2(double(Base)) - 2 - std::log2(double(digits[length - 1]) * Base + digits[length - 2])) / 2;
+        std::uint32_t shift = exponent > 1 ? std::uint32_t(exponent) - 1 : 0;
+        UnsignedInteger normalized = *this;
+        if (shift)
+            normalized.multiplyScalar(std::uint64_t(1) << (shift << 1));
+        for (; normalized.length < targetLength || normalized.digits[targetLength - 1] < Base / 4; ++shift)
+            normalized.multiplyScalar(4);
+        std::pair<UnsignedInteger, UnsignedInteger> result = normalized.normalizedSqrtRem();
+        if (shift) {
+            result.first.divideScalar(std::uint64_t(1) << shift);
+            result.second = exactRemainder ? *this - result.first.product(result.first) : UnsignedInteger();
+        }
+        return result;
+    }
+
+    UnsignedInteger rootNewton(std::uint32_t degree) const {
+        const std::uint32_t rootLength = (length + degree - 1) / degree;
+        UnsignedInteger root;
+        if (rootLength <= 2)
+            root = UnsignedInteger(std::exp((std::log(double(digits[length - 1]) + (length > 1 ? (digits[length - 2] + (length > 2 ? digits[length - 3] / double(Base) : 0)) / Base : 0)) + (length - 1) * std::log(double(Base))) / degree) * (1 + 1e-10) + 1);
+        else {
+            const std::uint32_t dropped = (rootLength - 1) >> 1;
+            root = (++rightShift(dropped * degree).rootNewton(degree)).leftShift(dropped);
+        }
+        for (;;) {
+            UnsignedInteger next = divisionAndModulus(pow(root, degree - 1)).first;
+            next += UnsignedInteger(root).multiplyScalar(degree - 1);
+            if (next.divideScalar(degree), next >= root)
+                return root;
+            root = std::move(next);
+        }
+    }
+
+    template <typename Iterator>
+    static UnsignedInteger productTree(Iterator first, std::size_t count) {
+        if (count < 2)
+            return count ? UnsignedInteger(*first) : UnsignedInteger(1);
+        UnsignedInteger result = productTree(first, count >> 1);
+        return result *= productTree(std::next(first, count >> 1), count - (count >> 1));
+    }
+
+    struct HalfGcd;
+
+  public:
+    friend class UnsignedIntegerView;
+    friend class SignedInteger;
+    friend class PreparedMultiplier;
+    friend class BarrettContext;
+    template <std::uint32_t>
+    friend class FixedUnsignedInteger;
+
+    UnsignedInteger() : resource(IntegerMemoryResource::current()), digits(inlineDigits), length(1), capacity(InlineCapacity), inlineDigits() {}
+
+    UnsignedInteger(const UnsignedInteger& other) : UnsignedInteger(other.length, other.length) {
+        std::memcpy(digits, other.digits, length << 2);
+    }
+
+    UnsignedInteger(UnsignedInteger&& other) noexcept : resource(other.resource), digits(inlineDigits), length(1), capacity(InlineCapacity) {
+        stealDigits(other);
+    }
+
+    UnsignedInteger(const SignedInteger& other);
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    UnsignedInteger(unsignedIntegral value) : UnsignedInteger(0, (std::numeric_limits<unsignedIntegral>::digits10 + 7) >> 3) {
+        for (std::uint64_t remaining = value; digits[length++] = std::uint32_t(remaining % Base), remaining /= Base;);
+    }
+
+    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
+    UnsignedInteger(signedIntegral value) : UnsignedInteger(0, (std::numeric_limits<signedIntegral>::digits10 + 7) >> 3) {
+        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger constructor error: the provided signed integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        for (std::uint64_t remaining = std::uint64_t(value); digits[length++] = std::uint32_t(remaining % Base), remaining /= Base;);
+    }
+
+    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
+    UnsignedInteger(floatingPoint value) : UnsignedInteger(0, (std::numeric_limits<floatingPoint>::max_exponent10 + 7) >> 3) {
+        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger constructor error: the provided floating point value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        VALIDITY_CHECK(std::isfinite(value), std::invalid_argument, "UnsignedInteger constructor error: the provided floating point value = " + std::to_string(value) + " is not finite.")
+        while (digits[length++] = std::uint32_t(std::fmod(value, Base)), (value = std::floor(value / Base)));
+    }
+
+    UnsignedInteger(const char* value) : resource(IntegerMemoryResource::current()), digits(inlineDigits), length(0), capacity(InlineCapacity) {
+        VALIDITY_CHECK(value, std::invalid_argument, "UnsignedInteger constructor error: the provided C-style string is a null pointer.")
+        const std::uint32_t stringLength = std::uint32_t(std::strlen(value));
+        reserveDiscarding(length = (stringLength + 7) >> 3);
+        VALIDITY_CHECK(stringLength, std::invalid_argument, "UnsignedInteger constructor error: the provided C-style string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        VALIDITY_CHECK(std::all_of(value, value + stringLength, [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger constructor error: the provided C-style string value = "
+                                                                                                                                                " + std::string(value) + "
+                                                                                                                                                " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        construct(value, stringLength);
+    }
+
+    UnsignedInteger(const std::string& value) : UnsignedInteger(std::uint32_t(value.size() + 7) >> 3, std::uint32_t(value.size() + 7) >> 3) {
+        VALIDITY_CHECK(value.size(), std::invalid_argument, "UnsignedInteger constructor error: the provided string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        VALIDITY_CHECK(std::all_of(value.begin(), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger constructor error: the provided string value = "
+                                                                                                                                               " + value + "
+                                                                                                                                               " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        construct(value.data(), std::uint32_t(value.size()));
+    }
+
+    ~UnsignedInteger() noexcept {
+        releaseDigits();
+    }
+
+    UnsignedInteger& operator=(const UnsignedInteger& other) {
+        if (digits != other.digits)
+            reserveDiscarding(other.length), std::memcpy(digits, other.digits, (length = other.length) << 2);
+        return *this;
+    }
+
+    UnsignedInteger& operator=(UnsignedInteger&& other) {
+        if (this != &other)
+            stealDigits(other);
+        return *this;
+    }
+
+    UnsignedInteger& operator=(const SignedInteger& other);
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    UnsignedInteger& operator=(unsignedIntegral value) {
+        reserveDiscarding((std::numeric_limits<unsignedIntegral>::digits10 + 7) >> 3), length = 0;
+        for (std::uint64_t remaining = value; digits[length++] = std::uint32_t(remaining % Base), remaining /= Base;);
+        return *this;
+    }
+
+    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
+    UnsignedInteger& operator=(signedIntegral value) {
+        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger operator= error: the provided signed integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        reserveDiscarding((std::numeric_limits<signedIntegral>::digits10 + 7) >> 3), length = 0;
+        for (std::uint64_t remaining = std::uint64_t(value); digits[length++] = std::uint32_t(remaining % Base), remaining /= Base;);
+        return *this;
+    }
+
+    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
+    UnsignedInteger& operator=(floatingPoint value) {
+        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger operator= error: the provided floating point value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        VALIDITY_CHECK(std::isfinite(value), std::invalid_argument, "UnsignedInteger operator= error: the provided floating point value = " + std::to_string(value) + " is not finite.")
+        reserveDiscarding((std::numeric_limits<floatingPoint>::max_exponent10 + 7) >> 3), length = 0;
+        while (digits[length++] = std::uint32_t(std::fmod(value, Base)), (value = std::floor(value / Base)));
+        return *this;
+    }
+
+    UnsignedInteger& operator=(const char* value) {
+        VALIDITY_CHECK(value, std::invalid_argument, "UnsignedInteger operator= error: the provided C-style string is a null pointer.")
+        const std::uint32_t stringLength = std::uint32_t(std::strlen(value));
+        VALIDITY_CHECK(stringLength, std::invalid_argument, "UnsignedInteger operator= error: the provided C-style string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        VALIDITY_CHECK(std::all_of(value, value + stringLength, [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger operator= error: the provided C-style string value = "
+                                                                                                                                                " + std::string(value) + "
+                                                                                                                                                " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        reserveDiscarding(length = (stringLength + 7) >> 3);
+        return construct(value, stringLength), *this;
+    }
+
+    UnsignedInteger& operator=(const std::string& value) {
+        VALIDITY_CHECK(value.size(), std::invalid_argument, "UnsignedInteger operator= error: the provided string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        VALIDITY_CHECK(std::all_of(value.begin(), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger operator= error: the provided string value = "
+                                                                                                                                               " + value + "
+                                                                                                                                               " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        reserveDiscarding(length = std::uint32_t(value.size() + 7) >> 3);
+        return construct(value.data(), std::uint32_t(value.size())), *this;
+    }
+
+    friend std::istream& operator>>(std::istream& stream, UnsignedInteger& destination) {
+        const std::istream::sentry guard(stream);
+        if (guard) {
+            if (stream.rdbuf()->sgetc() == '+')
+                stream.rdbuf()->sbumpc();
+            destination.readDecimal(stream);
+        }
+        return stream;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const UnsignedInteger& source) {
+        return source.writeDecimal(stream, false), stream;
+    }
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    operator unsignedIntegral() const {
+        unsignedIntegral result = 0;
+        for (std::uint32_t* i = digits + length; i != digits; result = result * unsignedIntegral(Base) + unsignedIntegral(*--i));
+        return result;
+    }
+
+    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
+    operator signedIntegral() const {
+        using UnsignedT = typename std::make_unsigned<signedIntegral>::type;
+        UnsignedT result = 0;
+        for (std::uint32_t* i = digits + length; i != digits; result = result * UnsignedT(Base) + UnsignedT(*--i));
+        return static_cast<signedIntegral>(result);
+    }
+
+    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
+    operator floatingPoint() const {
+        floatingPoint result = 0;
+        for (std::uint32_t* i = digits + length; i != digits; result = result * floatingPoint(Base) + floatingPoint(*--i));
+        return result;
+    }
+
+    explicit operator const char*() const {
+        thread_local char* result = nullptr;
+        thread_local std::uint32_t resultLength = 0;
+        if (!length) {
+            if (resultLength < 2)
+                delete[] result, result = new char[resultLength = 2];
+            result[0] = '0';
+            result[1] = 0;
+            return result;
+        }
+        if (resultLength < (length << 3 | 7))
+            delete[] result, result = new char[resultLength = length << 3 | 7];
+        char* resultPointer = result + 8;
+        std::uint32_t *i = digits + length, numberLength = 0;
+        for (std::uint32_t number = *--i; *--resultPointer = char(48 | number % 10), ++numberLength, number /= 10;);
+        for (std::memmove(result, resultPointer, numberLength), resultPointer = result + numberLength; i-- != digits; std::memcpy(resultPointer, detail::O(*i / 10000), 4), resultPointer += 4, std::memcpy(resultPointer, detail::O(*i % 10000), 4), resultPointer += 4);
+        return *resultPointer = 0, result;
+    }
+
+    operator std::string() const {
+        if (!length)
+            return "0";
+        std::uint32_t* i = digits + length;
+        std::string result = std::to_string(*--i);
+        for (result.reserve(length << 3); i-- != digits; result.append(detail::O(*i / 10000), 4), result.append(detail::O(*i % 10000), 4));
+        return result;
+    }
+
+    std::size_t decimalLength() const noexcept {
+        std::size_t result = length ? std::size_t(length - 1) << 3 | 1 : 1;
+        for (std::uint32_t number = length ? digits[length - 1] : 0; number >= 10; number /= 10, ++result);
+        return result;
+    }
+
+    char* toChars(char* first, char* last) const noexcept {
+        if (last < first || std::size_t(last - first) < decimalLength())
+            return nullptr;
+        char* position = writeLeadingDigit(first);
+        for (std::uint32_t i = length ? length - 1 : 0; i--; position = writeDigit(position, digits[i]));
+        return position;
+    }
+
+    std::string toString(std::uint32_t radix) const;
+
+    static UnsignedInteger fromString(const std::string& value, std::uint32_t radix);
+
+    std::vector<std::uint8_t> toBytes() const;
+
+    static UnsignedInteger fromBytes(const std::vector<std::uint8_t>& bytes);
+
+    std::size_t serializedSize() const noexcept {
+        return detail::SerializedHeaderSize + (std::size_t(length) << 2);
+    }
+
+    std::uint8_t* serialize(std::uint8_t* destination) const noexcept {
+        return detail::storeLittleEndian(destination = writeSerializedHeader(destination, false, length), digits, length), destination + (std::size_t(length) << 2);
+    }
+
+    std::vector<std::uint8_t> serialize() const {
+        std::vector<std::uint8_t> result(serializedSize());
+        return serialize(result.data()), result;
+    }
+
+    static UnsignedInteger deserialize(const std::uint8_t* data, std::size_t size) {
+        bool negative;
+        const std::uint32_t limbCount = readSerializedHeader(data, size, negative);
+        VALIDITY_CHECK(!negative, std::invalid_argument, "UnsignedInteger deserialize error: the serialized integer is negative.")
+        return loadSerialized(data, limbCount);
+    }
+
+    static UnsignedInteger deserialize(const std::vector<std::uint8_t>& bytes) {
+        return deserialize(bytes.data(), bytes.size());
+    }
+
+    template <typename Iterator, typename std::enable_if<std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value && std::is_convertible<typename std::iterator_traits<Iterator>::value_type, UnsignedInteger>::value, int>::type = 0>
+    static UnsignedInteger product(Iterator first, Iterator last) {
+        const std::size_t count = std::size_t(std::distance(first, last));
+        IntegerExecutor* executor = IntegerExecutor::current();
+        const std::uint32_t taskCount = !executor || executor->concurrency() < 2 ? 1 : std::uint32_t(std::min<std::size_t>(count >> 1, executor->concurrency()));
+        if (taskCount < 2)
+            return productTree(first, count);
+        const IntegerMemoryScope callerScope(nullptr);
+        std::vector<UnsignedInteger> partial(taskCount);
+        detail::isolatedParallelFor(executor, taskCount, std::uint32_t(count), [&](std::uint32_t begin, std::uint32_t end, std::uint32_t task) {
+            partial[task] = productTree(std::next(first, begin), end - begin);
+        });
+        return productTree(partial.begin(), taskCount);
+    }
+
+    static UnsignedInteger product(const std::vector<UnsignedInteger>& values) {
+        return product(values.begin(), values.end());
+    }
+
+    static UnsignedInteger factorial(std::uint32_t n);
+
+    static UnsignedInteger binomial(std::uint32_t n, std::uint32_t k);
+
+    static void releaseScratch(std::uint32_t keepLength = 0) noexcept;
+
+    static void multiplyBatch(const UnsignedInteger* first, const UnsignedInteger* second, UnsignedInteger* result, std::uint32_t count) {
+        IntegerExecutor* executor = IntegerExecutor::current();
+        const std::uint32_t taskCount = !executor || executor->concurrency() < 2 ? 1 : std::min(count, executor->concurrency() << 2);
+        if (taskCount < 2)
+            return multiplyRun(first, second, result, count);
+        const IntegerMemoryScope callerScope(nullptr);
+        std::vector<UnsignedInteger> products(count);
+        detail::isolatedParallelFor(executor, taskCount, count, [&](std::uint32_t begin, std::uint32_t end, std::uint32_t) {
+            multiplyRun(first + begin, second + begin, products.data() + begin, end - begin);
+        });
+        std::move(products.begin(), products.end(), result);
+    }
+
+    static std::vector<UnsignedInteger> multiplyBatch(const std::vector<UnsignedInteger>& first, const std::vector<UnsignedInteger>& second) {
+        VALIDITY_CHECK(first.size() == second.size(), std::invalid_argument, "UnsignedInteger batch multiplication error: operand counts differ.")
+        std::vector<UnsignedInteger> result(first.size());
+        multiplyBatch(first.data(), second.data(), result.data(), std::uint32_t(first.size()));
+        return result;
+    }
+
+    operator bool() const noexcept {
+        return length != 1 || *digits;
+    }
+
+#if __cplusplus >= 202002L
+    std::strong_ordering operator<=>(const UnsignedInteger& other) const {
+        return length == other.length ? reverseCompare(other) <=> 0 : length <=> other.length;
+    }
+#endif
+
+    bool operator==(const UnsignedInteger& other) const {
+        return length == other.length && !std::memcmp(digits, other.digits, length << 2);
+    }
+
+    bool operator!=(const UnsignedInteger& other) const {
+        return length != other.length || std::memcmp(digits, other.digits, length << 2);
+    }
+
+    bool operator<(const UnsignedInteger& other) const {
+        return length < other.length || (length == other.length && reverseCompare(other) < 0);
+    }
+
+    bool operator>(const UnsignedInteger& other) const {
+        return length > other.length || (length == other.length && reverseCompare(other) > 0);
+    }
+
+    bool operator<=(const UnsignedInteger& other) const {
+        return length < other.length || (length == other.length && reverseCompare(other) <= 0);
+    }
+
+    bool operator>=(const UnsignedInteger& other) const {
+        return length > other.length || (length == other.length && reverseCompare(other) >= 0);
+    }
+
+    UnsignedInteger& operator+=(const UnsignedInteger& other) {
+        const std::uint32_t otherLength = other.length;
+        if (length <= otherLength) {
+            const std::uint32_t oldLength = length;
+            resize(otherLength + 1), std::memset(digits + oldLength, 0, (length - oldLength) << 2);
+        }
+        std::uint32_t *thisDigit = digits + otherLength, *thisEnd = digits + length - 1;
+        *thisDigit += addDigits(digits, other.digits, otherLength);
+        for (; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit -= Base, ++*++thisDigit);
+        if (thisDigit == thisEnd && *thisDigit >= Base)
+            resize(length + 1), digits[length - 2] -= Base, digits[length - 1] = 1;
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    UnsignedInteger operator+(const UnsignedInteger& other) const& {
+        return length >= other.length ? copyWithCapacity(1) += other : other.copyWithCapacity(1) += *this;
+    }
+
+    UnsignedInteger operator+(const UnsignedInteger& other) && {
+        return std::move(*this += other);
+    }
+
+    UnsignedInteger operator+(UnsignedInteger&& other) const& {
+        return std::move(other += *this);
+    }
+
+    UnsignedInteger operator+(UnsignedInteger&& other) && {
+        return std::move(capacity >= other.capacity ? *this += other : other += *this);
+    }
+
+    UnsignedInteger& operator++() {
+        std::uint32_t *thisDigit = digits, *thisEnd = digits + length - 1;
+        for (++*thisDigit; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit -= Base, ++*++thisDigit);
+        if (thisDigit == thisEnd && *thisDigit >= Base)
+            resize(length + 1), digits[length - 2] -= Base, digits[length - 1] = 1;
+        return *this;
+    }
+
+    UnsignedInteger operator++(int) {
+        UnsignedInteger result = *this;
+        return ++*this, result;
+    }
+
+    UnsignedInteger& operator-=(const UnsignedInteger& other) {
+        VALIDITY_CHECK(
+            *this >= other,
+            std::invalid_argument,
+            std::string("UnsignedInteger subtraction error: attempted to subtract a larger UnsignedInteger ") +
+                other.operator std::string() +
+                " from a smaller one " +
+                this->operator std::string() +
+                ".")
+        std::uint32_t *thisDigit = digits + other.length, *thisEnd = digits + length;
+        if (subtractDigits(digits, other.digits, other.length) && thisDigit != thisEnd)
+            for (--*thisDigit; thisDigit + 1 != thisEnd && *thisDigit >= Base; *thisDigit += Base, --*++thisDigit);
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    UnsignedInteger operator-(const UnsignedInteger& other) const& {
+        return UnsignedInteger(*this) -= other;
+    }
+
+    UnsignedInteger operator-(const UnsignedInteger& other) && {
+        return std::move(*this -= other);
+    }
+
+    UnsignedInteger operator-(UnsignedInteger&& other) const& {
+        return std::move(other.reverseSubtract(*this));
+    }
+
+    UnsignedInteger operator-(UnsignedInteger&& other) && {
+        return std::move(*this -= other);
+    }
+
+    UnsignedInteger& operator--() {
+        VALIDITY_CHECK(bool(*this), std::invalid_argument, "UnsignedInteger decrement error: value is already zero.")
+        std::uint32_t *thisDigit = digits, *thisEnd = digits + length - 1;
+        for (--*thisDigit; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit += Base, --*++thisDigit);
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    UnsignedInteger operator--(int) {
+        UnsignedInteger result = *this;
+        return --*this, result;
+    }
+
+    UnsignedInteger& operator*=(const UnsignedInteger& other) {
+        return *this = product(other);
+    }
+
+    UnsignedInteger& square() {
+        return *this = product(*this);
+    }
+
+    UnsignedInteger operator*(const UnsignedInteger& other) const {
+        return product(other);
+    }
+
+    friend UnsignedInteger fma(const UnsignedInteger& first, const UnsignedInteger& second, const UnsignedInteger& addend) {
+        return first.product(second, &addend);
+    }
+
+    friend UnsignedInteger& addmul(UnsignedInteger& accumulator, const UnsignedInteger& first, const UnsignedInteger& second) {
+        if (accumulator.length > first.length + second.length)
+            return accumulator += first.product(second);
+        return accumulator = first.product(second, &accumulator);
+    }
+
+    friend UnsignedInteger& submul(UnsignedInteger& accumulator, const UnsignedInteger& first, const UnsignedInteger& second) {
+        return accumulator -= first.product(second);
+    }
+
+    friend UnsignedInteger mulmod(const UnsignedInteger& first, const UnsignedInteger& second, const UnsignedInteger& modulus) {
+        VALIDITY_CHECK(bool(modulus), std::invalid_argument, "UnsignedInteger modulus error: modulus is zero.")
+        return first.product(second).divisionAndModulus(modulus).second;
+    }
+
+    UnsignedInteger& multiply(const PreparedMultiplier& multiplier);
+
+    friend UnsignedInteger pow(const UnsignedInteger& base, const UnsignedInteger& exponent) {
+        return slidingWindowPower(base, exponent, [](UnsignedInteger&) {});
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend UnsignedInteger pow(const UnsignedInteger& base, integral exponent) {
+        return pow(base, UnsignedInteger(exponent));
+    }
+
+    friend UnsignedInteger powmod(const UnsignedInteger& base, const UnsignedInteger& exponent, const UnsignedInteger& modulus);
+
+    friend UnsignedInteger sqrt(const UnsignedInteger& value) {
+        return std::move(value.sqrtRemainder(false).first);
+    }
+
+    friend std::pair<UnsignedInteger, UnsignedInteger> sqrtrem(const UnsignedInteger& value) {
+        return value.sqrtRemainder(true);
+    }
+
+    friend UnsignedInteger nthRoot(const UnsignedInteger& value, std::uint32_t degree) {
+        VALIDITY_CHECK(degree, std::invalid_argument, "UnsignedInteger nthRoot error: degree is zero.")
+        if (degree == 1 || value.compareScalar(1) <= 0)
+            return value;
+        // value < 10^digitCount <= 2^degree puts the root below 2; this also keeps the first Newton step from building 2^(degree - 1).
+        if (degree > std::uint64_t(value.digitCount()) * 3322 / 1000)
+            return UnsignedInteger(1);
+        return degree == 2 ? sqrt(value) : value.rootNewton(degree);
+    }
+
+    friend bool isPerfectSquare(const UnsignedInteger& value) {
+        if (!detail::QuadraticResidues<256>.contains(value.digits[0]) || !detail::QuadraticResidues<625>.contains(value.digits[0]))
+            return false;
+        const std::uint64_t residue = value.remainderScalar(std::uint64_t(63) * 65 * 11 * 17 * 19 * 23 * 29);
+        if (!detail::QuadraticResidues<63>.contains(residue) || !detail::QuadraticResidues<65>.contains(residue) || !detail::QuadraticResidues<11>.contains(residue) || !detail::QuadraticResidues<17>.contains(residue) || !detail::QuadraticResidues<19>.contains(residue) || !detail::QuadraticResidues<23>.contains(residue) || !detail::QuadraticResidues<29>.contains(residue))
+            return false;
+        return !value.sqrtRemainder(true).second;
+    }
+
+    friend UnsignedInteger gcd(const UnsignedInteger& first, const UnsignedInteger& second);
+
+    friend UnsignedInteger lcm(const UnsignedInteger& first, const UnsignedInteger& second) {
+        if (!first || !second)
+            return UnsignedInteger();
+        return first / gcd(first, second) * second;
+    }
+
+    friend std::tuple<UnsignedInteger, SignedInteger, SignedInteger> gcdext(const UnsignedInteger& first, const UnsignedInteger& second);
+
+    friend UnsignedInteger modinv(const UnsignedInteger& value, const UnsignedInteger& modulus);
+
+    UnsignedInteger& operator/=(const UnsignedInteger& other) {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "UnsignedInteger division error: divisor is zero.")
+        return *this = std::move(divisionAndModulus(other).first);
+    }
+
+    UnsignedInteger operator/(const UnsignedInteger& other) const {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "UnsignedInteger division error: divisor is zero.")
+        return std::move(divisionAndModulus(other).first);
+    }
+
+    UnsignedInteger& operator%=(const UnsignedInteger& other) {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "UnsignedInteger modulus error: modulus is zero.")
+        return *this = std::move(divisionAndModulus(other).second);
+    }
+
+    UnsignedInteger operator%(const UnsignedInteger& other) const {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "UnsignedInteger modulus error: modulus is zero.")
+        return std::move(divisionAndModulus(other).second);
+    }
+
+    friend std::pair<UnsignedInteger, UnsignedInteger> divmod(const UnsignedInteger& dividend, const UnsignedInteger& divisor) {
+        VALIDITY_CHECK(bool(divisor), std::invalid_argument, "UnsignedInteger divmod error: divisor is zero.")
+        return dividend.divisionAndModulus(divisor);
+    }
+
+    friend void divmod(const UnsignedInteger& dividend, const UnsignedInteger& divisor, UnsignedInteger& quotient, UnsignedInteger& remainder) {
+        VALIDITY_CHECK(bool(divisor), std::invalid_argument, "UnsignedInteger divmod error: divisor is zero.")
+        const bool aliased = &quotient == &remainder || &quotient == &dividend || &quotient == &divisor || &remainder == &dividend || &remainder == &divisor;
+        if (!aliased && (dividend.length < BruteforceThreshold || divisor.length < BruteforceThreshold))
+            return dividend.bruteforceDivisionAndModulus(divisor, quotient, remainder);
+        std::pair<UnsignedInteger, UnsignedInteger> result = dividend.divisionAndModulus(divisor);
+        quotient = std::move(result.first), remainder = std::move(result.second);
+    }
+
+    // Multiplies by 10^shift: a limb shift plus one pass scaling by 10^(shift % 8).
+    UnsignedInteger& shiftLeftDecimal(std::uint32_t shift) {
+        if (!*this || !shift)
+            return *this;
+        const std::uint32_t limbShift = shift >> 3, low = detail::DecimalPowers[8 - (shift & 7)], high = Base / low, oldLength = length;
+        VALIDITY_CHECK(length + std::uint64_t(limbShift) < std::numeric_limits<std::uint32_t>::max(), std::invalid_argument, "UnsignedInteger shiftLeftDecimal error: the shift " + std::to_string(shift) + " is too large.")
+        resize(length + limbShift + 1);
+        for (std::uint32_t i = oldLength + 1; i--;)
+            digits[i + limbShift] = (i != oldLength ? digits[i] % low * high : 0) + (i ? digits[i - 1] / low : 0);
+        std::memset(digits, 0, limbShift << 2);
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    // Divides by 10^shift, truncating.
+    UnsignedInteger& shiftRightDecimal(std::uint32_t shift) {
+        const std::uint32_t limbShift = shift >> 3, low = detail::DecimalPowers[shift & 7], high = Base / low;
+        if (limbShift >= length)
+            return length = 1, *digits = 0, *this;
+        length -= limbShift;
+        for (std::uint32_t i = 0; i != length; ++i)
+            digits[i] = digits[i + limbShift] / low + (i + 1 != length ? digits[i + limbShift + 1] % low * high : 0);
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    // Keeps the lowest shift decimal digits, i.e. reduces modulo 10^shift.
+    UnsignedInteger& modPow10(std::uint32_t shift) {
+        const std::uint32_t limbCount = shift >> 3, partial = shift & 7;
+        if (limbCount >= length)
+            return *this;
+        if (!shift)
+            return length = 1, *digits = 0, *this;
+        if (partial)
+            digits[limbCount] %= detail::DecimalPowers[partial];
+        length = limbCount + (partial != 0);
+        for (; length > 1 && !digits[length - 1]; --length);
+        return *this;
+    }
+
+    std::uint32_t digitCount() const noexcept {
+        const std::uint32_t top = digits[length - 1];
+        std::uint32_t count = ((length - 1) << 3) + 1;
+        for (std::uint32_t i = 1; i != 8 && top >= detail::DecimalPowers[i]; ++i, ++count);
+        return count;
+    }
+
+    // The decimal digit of weight 10^position (0 beyond the most significant digit).
+    std::uint32_t digitAt(std::uint32_t position) const noexcept {
+        return position >> 3 < length ? digits[position >> 3] / detail::DecimalPowers[position & 7] % 10 : 0;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger& operator+=(integral value) {
+        VALIDITY_CHECK(!detail::isNegative(value), std::invalid_argument, "UnsignedInteger addition error: the provided integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        return addScalar(std::uint64_t(value));
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator+(integral value) const& {
+        return copyWithCapacity(3) += value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator+(integral value) && {
+        return std::move(*this += value);
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend UnsignedInteger operator+(integral value, const UnsignedInteger& other) {
+        return other.copyWithCapacity(3) += value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger& operator-=(integral value) {
+        VALIDITY_CHECK(!detail::isNegative(value), std::invalid_argument, "UnsignedInteger subtraction error: the provided integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        VALIDITY_CHECK(compareScalar(std::uint64_t(value)) >= 0, std::invalid_argument, "UnsignedInteger subtraction error: attempted to subtract a larger integer " + std::to_string(value) + " from a smaller UnsignedInteger " + operator std::string() + ".")
+        return subtractScalar(std::uint64_t(value));
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator-(integral value) const& {
+        return UnsignedInteger(*this) -= value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator-(integral value) && {
+        return std::move(*this -= value);
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend UnsignedInteger operator-(integral value, const UnsignedInteger& other) {
+        return UnsignedInteger(value) -= other;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger& operator*=(integral value) {
+        VALIDITY_CHECK(!detail::isNegative(value), std::invalid_argument, "UnsignedInteger multiplication error: the provided integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        return multiplyScalar(std::uint64_t(value));
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator*(integral value) const& {
+        return copyWithCapacity(3) *= value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator*(integral value) && {
+        return std::move(*this *= value);
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend UnsignedInteger operator*(integral value, const UnsignedInteger& other) {
+        return other.copyWithCapacity(3) *= value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger& operator/=(integral value) {
+        VALIDITY_CHECK(!detail::isNegative(value), std::invalid_argument, "UnsignedInteger division error: the provided integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        VALIDITY_CHECK(value != 0, std::invalid_argument, "UnsignedInteger division error: divisor is zero.")
+        return divideScalar(std::uint64_t(value)), *this;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator/(integral value) const& {
+        return UnsignedInteger(*this) /= value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator/(integral value) && {
+        return std::move(*this /= value);
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend UnsignedInteger operator/(integral value, const UnsignedInteger& other) {
+        return UnsignedInteger(value) / other;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger& operator%=(integral value) {
+        return *this = *this % value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    UnsignedInteger operator%(integral value) const {
+        VALIDITY_CHECK(!detail::isNegative(value), std::invalid_argument, "UnsignedInteger modulus error: the provided integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
+        VALIDITY_CHECK(value != 0, std::invalid_argument, "UnsignedInteger modulus error: modulus is zero.")
+        return UnsignedInteger(remainderScalar(std::uint64_t(value)));
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend UnsignedInteger operator%(integral value, const UnsignedInteger& other) {
+        return UnsignedInteger(value) % other;
+    }
+};
+
+inline UnsignedInteger operator""_UI(const char* literal, std::size_t) {
+    return UnsignedInteger(literal);
+}
+
+class PreparedMultiplier {
+    UnsignedInteger value;
+    mutable detail::TransformHelper::Complex* images[32];
+
+    const detail::TransformHelper::Complex* image(std::uint32_t transformLength) const {
+        detail::TransformHelper::Complex*& cachedImage = images[detail::log2(transformLength)];
+        if (!cachedImage)
+            value.forwardTransform(cachedImage = new detail::TransformHelper::Complex[transformLength], transformLength);
+        return cachedImage;
+    }
+
+  public:
+    friend class UnsignedInteger;
+
+    PreparedMultiplier(const UnsignedInteger& multiplier) : value(multiplier), images() {}
+
+    PreparedMultiplier(const PreparedMultiplier& other) : value(other.value), images() {}
+
+    PreparedMultiplier(PreparedMultiplier&& other) noexcept : value(std::move(other.value)) {
+        std::memcpy(images, other.images, sizeof(images)), std::memset(other.images, 0, sizeof(other.images));
+    }
+
+    ~PreparedMultiplier() noexcept {
+        for (detail::TransformHelper::Complex* cachedImage : images)
+            delete[] cachedImage;
+    }
+
+    PreparedMultiplier& operator=(const PreparedMultiplier& other) {
+        return *this = PreparedMultiplier(other);
+    }
+
+    PreparedMultiplier& operator=(PreparedMultiplier&& other) {
+        if (this != &other) {
+            for (detail::TransformHelper::Complex*& cachedImage : images)
+                delete[] cachedImage, cachedImage = nullptr;
+            value = std::move(other.value), std::swap(images, other.images);
+        }
+        return *this;
+    }
+
+    const UnsignedInteger& multiplier() const {
+        return value;
+    }
+};
+
+inline UnsignedInteger& UnsignedInteger::multiply(const PreparedMultiplier& multiplier) {
+    const UnsignedInteger& other = multiplier.value;
+    const MultiplyTier tier = multiplyTier(other);
+    if (tier == MultiplyTier::Bruteforce)
+        return *this = bruteforceMultiply(other);
+    if (tier == MultiplyTier::ModularTransform)
+        return *this = modularTransformMultiply(other);
+    bool wrapAround;
+    const std::uint32_t transformLength = transformLayout(other, wrapAround);
+    return *this = transformMultiply(other, multiplier.image(transformLength), transformLength, wrapAround);
+}
+
+inline std::pair<UnsignedInteger, UnsignedInteger> UnsignedInteger::divisionAndModulus(const UnsignedInteger& other) const {
+    if (*this < other)
+        return std::make_pair(UnsignedInteger(), *this);
+    if (length < BruteforceThreshold || other.length < BruteforceThreshold)
+        return bruteforceDivisionAndModulus(other);
+    INTEGER_PROFILE(NewtonDivision, length);
+    const std::uint32_t precisionBits = length - other.length + 5, shiftBack = precisionBits > other.length ? 0 : other.length - precisionBits;
+    UnsignedInteger adjustedDivisor = other.rightShift(shiftBack);
+    if (shiftBack)
+        ++adjustedDivisor;
+    const std::uint32_t inversePrecision = precisionBits + adjustedDivisor.length, dropped = other.length - 2, cycleLength = 2u << detail::log2(other.length + 1);
+    // Limbs of *this below other.length - 2 move the quotient estimate by less than one, and the remainder of an estimate that is off by a few
+    // fits in other.length + 1 limbs, so it is taken from a cyclic product instead of the full quotient * other.
+    UnsignedInteger quotient = rightShift(dropped).product(adjustedDivisor.computeInverse(inversePrecision)).rightShift(inversePrecision + shiftBack - dropped);
+    bool negative;
+    UnsignedInteger remainder = cyclicDifference(cyclicFold(cycleLength), quotient.cyclicProduct(other, cycleLength), cycleLength, negative);
+    INTEGER_PROFILE(DivisionCorrection, other.length);
+    for (; negative; --quotient)
+        if (remainder <= other)
+            remainder = other - remainder, negative = false;
+        else
+            remainder -= other;
+    for (; remainder >= other; ++quotient, remainder -= other);
+    return std::make_pair(std::move(quotient), std::move(remainder));
+}
+
+class BarrettContext {
+    PreparedMultiplier modulusMultiplier, reciprocalMultiplier;
+    std::uint32_t modulusLength;
+
+  public:
+    BarrettContext(const UnsignedInteger& modulus) : modulusMultiplier(modulus), reciprocalMultiplier(UnsignedInteger(1).leftShift(modulus.length << 1) / modulus), modulusLength(modulus.length) {}
+
+    const UnsignedInteger& modulus() const {
+        return modulusMultiplier.multiplier();
+    }
+
+    const PreparedMultiplier& preparedModulus() const {
+        return modulusMultiplier;
+    }
+
+    void reduceInPlace(UnsignedInteger& value) const {
+        const UnsignedInteger& modulusValue = modulus();
+        if (value < modulusValue)
+            return;
+        if (value.length > modulusLength << 1) {
+            value %= modulusValue;
+            return;
+        }
+        UnsignedInteger quotient = value.rightShift(modulusLength - 1);
+        quotient = quotient.multiply(reciprocalMultiplier).rightShift(modulusLength + 1);
+        for (value -= quotient.multiply(modulusMultiplier); value >= modulusValue; value -= modulusValue);
+    }
+
+    UnsignedInteger divideInPlace(UnsignedInteger& value) const {
+        const UnsignedInteger& modulusValue = modulus();
+        if (value < modulusValue)
+            return UnsignedInteger();
+        if (value.length > modulusLength << 1) {
+            std::pair<UnsignedInteger, UnsignedInteger> result = value.divisionAndModulus(modulusValue);
+            return value = std::move(result.second), std::move(result.first);
+        }
+        UnsignedInteger quotient = value.rightShift(modulusLength - 1);
+        quotient = quotient.multiply(reciprocalMultiplier).rightShift(modulusLength + 1);
+        for (value -= UnsignedInteger(quotient).multiply(modulusMultiplier); value >= modulusValue; value -= modulusValue, ++quotient);
+        return quotient;
+    }
+
+    UnsignedInteger reduce(const UnsignedInteger& value) const {
+        UnsignedInteger result = value;
+        return reduceInPlace(result), result;
+    }
+
+    UnsignedInteger mulmod(const UnsignedInteger& first, const UnsignedInteger& second) const {
+        UnsignedInteger product = first;
+        if (&first == &second)
+            product.square();
+        else
+            product *= second;
+        return reduceInPlace(product), product;
+    }
+
+    UnsignedInteger powmod(const UnsignedInteger& base, const UnsignedInteger& exponent) const {
+        return UnsignedInteger::slidingWindowPower(base, exponent, [this](UnsignedInteger& value) { reduceInPlace(value); });
+    }
+};
+
+inline UnsignedInteger powmod(const UnsignedInteger& base, const UnsignedInteger& exponent, const UnsignedInteger& modulus) {
+    return BarrettContext(modulus).powmod(base, exponent);
+}
+
+struct UnsignedInteger::HalfGcd {
+    static constexpr std::uint32_t RecentLimit = 16;
+
+    UnsignedInteger alpha, beta, matrix[4];
+    std::vector<UnsignedInteger> recent;
+    std::size_t steps;
+    bool odd, tracking;
+
+    HalfGcd(UnsignedInteger first, UnsignedInteger second, bool trackMatrix = true) : alpha(std::move(first)), beta(std::move(second)), matrix{UnsignedInteger(1), UnsignedInteger(), UnsignedInteger(), UnsignedInteger(1)}, steps(0), odd(false), tracking(trackMatrix) {}
+
+    static bool reaches(const UnsignedInteger& value, std::uint32_t power) noexcept {
+        return value.length > power && bool(value);
+    }
+
+    void push(const UnsignedInteger& quotient) {
+        ++steps, odd = !odd;
+        if (!tracking)
+            return;
+        for (std::uint32_t row = 0; row != 4; row += 2) {
+            UnsignedInteger next = quotient * matrix[row];
+            next += matrix[row + 1];
+            matrix[row + 1] = std::move(matrix[row]), matrix[row] = std::move(next);
+        }
+        if (recent.size() == RecentLimit)
+            recent.erase(recent.begin());
+        recent.push_back(quotient);
+    }
+
+    void pop() {
+        const UnsignedInteger quotient = std::move(recent.back());
+        recent.pop_back(), --steps, odd = !odd;
+        for (std::uint32_t row = 0; row != 4; row += 2) {
+            UnsignedInteger next = std::move(matrix[row]);
+            next -= quotient * matrix[row + 1];
+            matrix[row] = std::move(matrix[row + 1]), matrix[row + 1] = std::move(next);
+        }
+    }
+
+    void combine(const HalfGcd& other) {
+        steps += other.steps, odd = odd != other.odd;
+        if (!tracking)
+            return;
+        for (std::uint32_t row = 0; row != 4; row += 2) {
+            UnsignedInteger first = matrix[row] * other.matrix[0], second = matrix[row] * other.matrix[1];
+            first += matrix[row + 1] * other.matrix[2], second += matrix[row + 1] * other.matrix[3];
+            matrix[row] = std::move(first), matrix[row + 1] = std::move(second);
+        }
+        if (other.steps != other.recent.size())
+            recent.clear();
+        recent.insert(recent.end(), other.recent.begin(), other.recent.end());
+        if (recent.size() > RecentLimit)
+            recent.erase(recent.begin(), recent.end() - RecentLimit);
+    }
+
+    static bool difference(UnsignedInteger positive, UnsignedInteger negative, bool swapped, UnsignedInteger& result) {
+        if (swapped)
+            std::swap(positive, negative);
+        if (positive < negative)
+            return false;
+        result = std::move(positive -= negative);
+        return true;
+    }
+
+    bool adopt(HalfGcd& other, std::uint32_t power) {
+        UnsignedInteger first, second;
+        for (; other.steps; other.pop()) {
+            if (difference(other.matrix[3] * alpha, other.matrix[1] * beta, other.odd, first) && difference(other.matrix[0] * beta, other.matrix[2] * alpha, other.odd, second) && first > second && reaches(second, power)) {
+                alpha = std::move(first), beta = std::move(second), combine(other);
+                return true;
+            }
+            if (other.recent.empty())
+                return false;
+        }
+        return false;
+    }
+
+    void divisionStep() {
+        std::pair<UnsignedInteger, UnsignedInteger> result = alpha.divisionAndModulus(beta);
+        alpha = std::move(beta), beta = std::move(result.second), push(result.first);
+    }
+
+    static bool linear(const UnsignedInteger& first, std::int64_t firstFactor, const UnsignedInteger& second, std::int64_t secondFactor, UnsignedInteger& result) {
+        const std::uint32_t resultLength = std::max(first.length, second.length) + 2;
+        UnsignedInteger value(resultLength, resultLength);
+        std::int64_t carry = 0;
+        for (std::uint32_t i = 0; i != resultLength; ++i) {
+            carry += (i < first.length ? firstFactor * first.digits[i] : 0) + (i < second.length ? secondFactor * second.digits[i] : 0);
+            std::int64_t digit = carry % std::int64_t(Base);
+            carry /= std::int64_t(Base);
+            if (digit < 0)
+                digit += Base, --carry;
+            value.digits[i] = std::uint32_t(digit);
+        }
+        if (carry)
+            return false;
+        for (; value.length > 1 && !value.digits[value.length - 1]; --value.length);
+        result = std::move(value);
+        return true;
+    }
+
+    void lehmerStep(std::uint32_t power) {
+        const std::uint32_t topLength = alpha.length;
+        if (topLength >= 2 && beta.length + 1 >= topLength) {
+            std::int64_t x = std::int64_t(alpha.digits[topLength - 1]) * Base + alpha.digits[topLength - 2], y = (beta.length == topLength ? std::int64_t(beta.digits[topLength - 1]) * Base : 0) + beta.digits[topLength - 2];
+            std::int64_t a = 1, b = 0, c = 0, d = 1, quotients[64];
+            std::uint32_t count = 0;
+            for (std::int64_t next; y + c > 0 && y + d > 0;) {
+                const std::int64_t quotient = (x + a) / (y + c);
+                if (!quotient || quotient != (x + b) / (y + d) || quotient >= std::int64_t(Base) || a - quotient * c <= -std::int64_t(Base) || a - quotient * c >= std::int64_t(Base) || b - quotient * d <= -std::int64_t(Base) || b - quotient * d >= std::int64_t(Base))
+                    break;
+                next = a - quotient * c, a = c, c = next;
+                next = b - quotient * d, b = d, d = next;
+                next = x - quotient * y, x = y, y = next;
+                quotients[count++] = quotient;
+            }
+            UnsignedInteger first, second;
+            if (count && linear(alpha, a, beta, b, first) && linear(alpha, c, beta, d, second) && first > second && reaches(second, power)) {
+                alpha = std::move(first), beta = std::move(second), steps += count, odd = odd != (count & 1);
+                if (!tracking)
+                    return;
+                for (std::uint32_t row = 0; row != 4; row += 2) {
+                    linear(matrix[row], std::abs(d), matrix[row + 1], std::abs(c), first), linear(matrix[row], std::abs(b), matrix[row + 1], std::abs(a), second);
+                    matrix[row] = std::move(first), matrix[row + 1] = std::move(second);
+                }
+                for (std::uint32_t i = count > RecentLimit ? count - RecentLimit : 0; i != count; ++i) {
+                    if (recent.size() == RecentLimit)
+                        recent.erase(recent.begin());
+                    recent.emplace_back(quotients[i]);
+                }
+                return;
+            }
+        }
+        divisionStep();
+    }
+
+    void reduce(std::uint32_t power) {
+        while (reaches(beta, power)) {
+            const std::uint32_t topLength = alpha.length, shift = std::max(topLength >> 1, 2 * power + 2 > topLength ? 2 * power + 2 - topLength : 0u);
+            if (topLength - shift < HalfGcdThreshold) {
+                lehmerStep(power);
+                continue;
+            }
+            HalfGcd other(alpha.rightShift(shift), beta.rightShift(shift));
+            other.reduce(((topLength - shift + 1) >> 1) + 1);
+            if (!adopt(other, power))
+                divisionStep();
+        }
+    }
+};
+
+inline UnsignedInteger gcd(const UnsignedInteger& first, const UnsignedInteger& second) {
+    UnsignedInteger::HalfGcd state(first < second ? second : first, first < second ? first : second, false);
+    state.reduce(0);
+    return std::move(state.alpha);
+}
+
+namespace detail {
+    struct WordProduct {
+        std::vector<UnsignedInteger> words;
+        std::uint64_t pending;
+
+        WordProduct() : pending(1) {}
+
+        void push(std::uint64_t factor) {
+            if (pending > std::numeric_limits<std::uint64_t>::max() / factor)
+                words.emplace_back(pending), pending = 1;
+            pending *= factor;
+        }
+
+        UnsignedInteger finish() {
+            words.emplace_back(pending), pending = 1;
+            return UnsignedInteger::product(words);
+        }
+    };
+
+    inline std::vector<std::uint32_t> primesUpTo(std::uint32_t limit) {
+        std::vector<std::uint32_t> primes;
+        if (limit < 2)
+            return primes;
+        std::vector<bool> composite((limit >> 1) + 1);
+        primes.push_back(2);
+        for (std::uint64_t i = 1; 2 * i + 1 <= limit; ++i)
+            if (!composite[i]) {
+                const std::uint64_t prime = 2 * i + 1;
+                primes.push_back(std::uint32_t(prime));
+                for (std::uint64_t j = prime * prime >> 1; j < composite.size(); j += prime)
+                    composite[j] = true;
+            }
+        return primes;
+    }
+
+    inline UnsignedInteger swingFactorial(std::uint32_t n, const std::vector<std::uint32_t>& primes) {
+        if (n < 21) {
+            std::uint64_t result = 1;
+            for (std::uint32_t i = 2; i <= n; ++i)
+                result *= i;
+            return UnsignedInteger(result);
+        }
+        WordProduct swing;
+        for (std::uint32_t prime : primes) {
+            if (prime > n)
+                break;
+            std::uint64_t power = 1;
+            for (std::uint32_t quotient = n / prime; quotient; quotient /= prime)
+                if (quotient & 1)
+                    power *= prime;
+            if (power > 1)
+                swing.push(power);
+        }
+        UnsignedInteger result = swingFactorial(n >> 1, primes);
+        return result.square() *= swing.finish();
+    }
+}
+
+inline UnsignedInteger UnsignedInteger::factorial(std::uint32_t n) {
+    return detail::swingFactorial(n, detail::primesUpTo(n));
+}
+
+inline UnsignedInteger UnsignedInteger::binomial(std::uint32_t n, std::uint32_t k) {
+    if (k > n)
+        return UnsignedInteger();
+    k = std::min(k, n - k);
+    detail::WordProduct result;
+    if (std::uint64_t(k) << 6 < n) {
+        for (std::uint64_t i = n - k + 1; i <= n; ++i)
+            result.push(i);
+        return result.finish() / factorial(k);
+    }
+    for (std::uint32_t prime : detail::primesUpTo(n)) {
+        std::uint64_t power = 1;
+        for (std::uint64_t modulus = prime; modulus <= n; modulus *= prime)
+            if (k % modulus > n % modulus)
+                power *= prime;
+        if (power > 1)
+            result.push(power);
+    }
+    return result.finish();
+}
+
+namespace detail {
+    struct RadixPowers {
+        std::uint32_t radix, chunkDigits, chunkValue;
+        std::vector<BarrettContext> levels;
+
+        RadixPowers() : radix(0), chunkDigits(0), chunkValue(1) {}
+
+        const BarrettContext& level(std::uint32_t index) {
+            const IntegerMemoryScope scope(nullptr);
+            for (; levels.size() <= index;) {
+                if (levels.empty())
+                    levels.emplace_back(UnsignedInteger(chunkValue));
+                else {
+                    UnsignedInteger power = levels.back().modulus();
+                    levels.emplace_back(power.square());
+                }
+            }
+            return levels[index];
+        }
+    };
+
+    inline RadixPowers* radixPowerTables() {
+        thread_local RadixPowers tables[37];
+        return tables;
+    }
+
+    inline RadixPowers& radixPowers(std::uint32_t radix) {
+        RadixPowers& powers = radixPowerTables()[radix == 256 ? 0 : radix];
+        if (!powers.radix)
+            for (powers.radix = radix; std::uint64_t(powers.chunkValue) * radix <= 0xffffffffu; powers.chunkValue *= radix, ++powers.chunkDigits);
+        return powers;
+    }
+
+    inline char radixCharacter(char value) {
+        return char(value < 10 ? '0' + value : 'a' + value - 10);
+    }
+
+    inline std::uint32_t radixValue(char character) {
+        return character >= '0' && character <= '9' ? std::uint32_t(character - '0') : character >= 'a' && character <= 'z' ? std::uint32_t(character - 'a' + 10) : character >= 'A' && character <= 'Z' ? std::uint32_t(character - 'A' + 10) : 0xffffffffu;
+    }
+} // namespace detail
+
+inline void UnsignedInteger::releaseScratch(std::uint32_t keepLength) noexcept {
+    for (detail::ScratchBuffer& buffer : detail::TransformBuffers)
+        buffer.release(keepLength);
+    for (detail::ScratchBuffer& buffer : detail::ModularBuffers)
+        buffer.release(keepLength);
+    for (detail::RadixPowers* powers = detail::radixPowerTables(); powers != detail::radixPowerTables() + 37; ++powers)
+        for (; !powers->levels.empty() && powers->levels.back().modulus().length > keepLength; powers->levels.pop_back());
+}
+
+inline std::int32_t UnsignedInteger::radixLevel(detail::RadixPowers& powers) const {
+    if (length <= RadixLeafThreshold)
+        return -1;
+    for (std::uint32_t level = 0;; ++level) {
+        const UnsignedInteger& power = powers.level(level).modulus();
+        if (length < (power.length << 1) - 1)
+            return std::int32_t(level);
+        if (length <= power.length << 1 && *this < UnsignedInteger(power).square())
+            return std::int32_t(level);
+    }
+}
+
+inline void UnsignedInteger::appendRadixDigits(const detail::RadixPowers& powers, std::int32_t level, std::uint32_t width, std::string& output) const {
+    if (level >= 0 && length > RadixLeafThreshold) {
+        UnsignedInteger remainder = *this;
+        UnsignedInteger quotient = powers.levels[level].divideInPlace(remainder);
+        const std::uint32_t halfWidth = powers.chunkDigits << level;
+        if (width || quotient)
+            quotient.appendRadixDigits(powers, level - 1, width ? halfWidth : 0, output);
+        remainder.appendRadixDigits(powers, level - 1, width || quotient ? halfWidth : 0, output);
+        return;
+    }
+    const std::size_t start = output.size();
+    std::vector<std::uint32_t> remaining(digits, digits + length);
+    for (std::uint32_t remainingLength = length; remainingLength > 1 || remaining[0];) {
+        std::uint64_t remainder = 0;
+        for (std::uint32_t i = remainingLength; i--;)
+            remainder = remainder * Base + remaining[i], remaining[i] = std::uint32_t(remainder / powers.chunkValue), remainder %= powers.chunkValue;
+        for (std::uint32_t i = 0; i < powers.chunkDigits; ++i, remainder /= powers.radix)
+            output.push_back(char(remainder % powers.radix));
+        for (; remainingLength > 1 && !remaining[remainingLength - 1]; --remainingLength);
+    }
+    if (width)
+        output.resize(start + width);
+    else
+        for (; output.size() > start + 1 && !output.back(); output.pop_back());
+    if (output.size() == start)
+        output.push_back(0);
+    std::reverse(output.begin() + std::ptrdiff_t(start), output.end());
+}
+
+inline UnsignedInteger UnsignedInteger::parseRadixDigits(detail::RadixPowers& powers, const char* values, std::uint32_t count) {
+    if (count > powers.chunkDigits * RadixLeafThreshold) {
+        std::uint32_t level = 0;
+        for (; (powers.chunkDigits << (level + 1)) < count; ++level);
+        const std::uint32_t lowCount = powers.chunkDigits << level;
+        UnsignedInteger result = parseRadixDigits(powers, values, count - lowCount);
+        result.multiply(powers.level(level).preparedModulus());
+        return result += parseRadixDigits(powers, values + (count - lowCount), lowCount);
+    }
+    const std::uint32_t resultCapacity = (count << 3) / 26 + 2;
+    UnsignedInteger result(1, resultCapacity);
+    result.digits[0] = 0;
+    for (std::uint32_t i = 0; i < count;) {
+        std::uint64_t carry = 0, multiplier = 1;
+        for (const std::uint32_t chunkEnd = std::min(count, i + powers.chunkDigits); i < chunkEnd; ++i)
+            carry = carry * powers.radix + std::uint8_t(values[i]), multiplier *= powers.radix;
+        for (std::uint32_t j = 0; j < result.length; ++j)
+            carry += result.digits[j] * multiplier, result.digits[j] = std::uint32_t(carry % Base), carry /= Base;
+        for (; carry; carry /= Base)
+            result.digits[result.length++] = std::uint32_t(carry % Base);
+    }
+    for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
+    return result;
+}
+
+inline std::string UnsignedInteger::toString(std::uint32_t radix) const {
+    VALIDITY_CHECK(radix >= 2 && radix <= 36, std::invalid_argument, "UnsignedInteger toString error: the provided radix = " + std::to_string(radix) + " is out of range. The radix must be between 2 and 36.")
+    if (radix == 10)
+        return operator std::string();
+    detail::RadixPowers& powers = detail::radixPowers(radix);
+    std::string result;
+    result.reserve(std::size_t(length) * 27 / detail::log2(radix) + 1);
+    appendRadixDigits(powers, radixLevel(powers), 0, result);
+    std::transform(result.begin(), result.end(), result.begin(), detail::radixCharacter);
+    return result;
+}
+
+inline UnsignedInteger UnsignedInteger::fromString(const std::string& value, std::uint32_t radix) {
+    VALIDITY_CHECK(radix >= 2 && radix <= 36, std::invalid_argument, "UnsignedInteger fromString error: the provided radix = " + std::to_string(radix) + " is out of range. The radix must be between 2 and 36.")
+    VALIDITY_CHECK(value.size(), std::invalid_argument, "UnsignedInteger fromString error: the provided string is empty.")
+    if (radix == 10)
+        return UnsignedInteger(value);
+    std::string values(value.size(), '\0');
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        values[i] = char(detail::radixValue(value[i]));
+        VALIDITY_CHECK(detail::radixValue(value[i]) < radix, std::invalid_argument, "UnsignedInteger fromString error: the provided string value = " + value + " contains characters that are not valid digits in radix " + std::to_string(radix) + ".")
+    }
+    return parseRadixDigits(detail::radixPowers(radix), values.data(), std::uint32_t(values.size()));
+}
+
+inline std::vector<std::uint8_t> UnsignedInteger::toBytes() const {
+    detail::RadixPowers& powers = detail::radixPowers(256);
+    std::string result;
+    appendRadixDigits(powers, radixLevel(powers), 0, result);
+    return std::vector<std::uint8_t>(result.begin(), result.end());
+}
+
+inline UnsignedInteger UnsignedInteger::fromBytes(const std::vector<std::uint8_t>& bytes) {
+    if (bytes.empty())
+        return UnsignedInteger();
+    return parseRadixDigits(detail::radixPowers(256), reinterpret_cast<const char*>(bytes.data()), std::uint32_t(bytes.size()));
+}
+
+class UnsignedIntegerView {
+    UnsignedInteger value;
+
+    static const std::uint32_t* zeroDigit() noexcept {
+        static const std::uint32_t zero = 0;
+        return &zero;
+    }
+
+  public:
+    UnsignedIntegerView() noexcept : value(zeroDigit(), 1, detail::BorrowedDigits::instance()) {}
+
+    UnsignedIntegerView(const std::uint32_t* limbs, std::uint32_t count) noexcept : UnsignedIntegerView() {
+        for (; count > 1 && !limbs[count - 1]; --count);
+        if (count)
+            value.digits = const_cast<std::uint32_t*>(limbs), value.length = value.capacity = count;
+    }
+
+    explicit UnsignedIntegerView(const UnsignedInteger& other) noexcept : UnsignedIntegerView(other.digits, other.length) {}
+
+    UnsignedIntegerView(const UnsignedIntegerView& other) noexcept : UnsignedIntegerView(other.value.digits, other.value.length) {}
+
+    UnsignedIntegerView& operator=(const UnsignedIntegerView& other) noexcept {
+        return value.digits = other.value.digits, value.length = value.capacity = other.value.length, *this;
+    }
+
+    static UnsignedIntegerView fromSerialized(const void* data, std::size_t size) {
+        bool negative;
+        const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+        const std::uint32_t limbCount = UnsignedInteger::readSerializedHeader(bytes, size, negative);
+        VALIDITY_CHECK(!negative, std::invalid_argument, "UnsignedIntegerView error: the serialized integer is negative.")
+        VALIDITY_CHECK(detail::littleEndianHost(), std::invalid_argument, "UnsignedIntegerView error: serialized limbs can only be viewed in place on little-endian hosts.")
+        VALIDITY_CHECK(!(reinterpret_cast<std::uintptr_t>(bytes + detail::SerializedHeaderSize) & 3), std::invalid_argument, "UnsignedIntegerView error: the serialized limbs are not 4-byte aligned.")
+        const std::uint32_t* limbs = reinterpret_cast<const std::uint32_t*>(bytes + detail::SerializedHeaderSize);
+        VALIDITY_CHECK(std::all_of(limbs, limbs + limbCount, [](std::uint32_t digit) { return digit < UnsignedInteger::Base; }), std::invalid_argument, "UnsignedIntegerView error: a limb is not below the base 100000000.")
+        return UnsignedIntegerView(limbs, limbCount);
+    }
+
+    const std::uint32_t* data() const noexcept {
+        return value.digits;
+    }
+
+    std::uint32_t size() const noexcept {
+        return value.length;
+    }
+
+    operator const UnsignedInteger&() const noexcept {
+        return value;
+    }
+
+    const UnsignedInteger& get() const noexcept {
+        return value;
+    }
+
+    friend UnsignedInteger operator+(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value + second;
+    }
+
+    friend UnsignedInteger operator-(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value - second;
+    }
+
+    friend UnsignedInteger operator*(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value * second;
+    }
+
+    friend UnsignedInteger operator/(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value / second;
+    }
+
+    friend UnsignedInteger operator%(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value % second;
+    }
+
+    friend bool operator==(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value == second;
+    }
+
+    friend bool operator!=(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value != second;
+    }
+
+    friend bool operator<(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value < second;
+    }
+
+    friend bool operator>(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value > second;
+    }
+
+    friend bool operator<=(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value <= second;
+    }
+
+    friend bool operator>=(const UnsignedIntegerView& first, const UnsignedInteger& second) {
+        return first.value >= second;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const UnsignedIntegerView& source) {
+        return stream << source.value;
+    }
+};
+
+class SignedInteger {
+    UnsignedInteger absolute;
+    bool sign;
+
+  protected:
+    SignedInteger(const UnsignedInteger& initialAbsolute, bool initialSign) : absolute(initialAbsolute), sign(initialSign) {}
+
+    SignedInteger(UnsignedInteger&& initialAbsolute, bool initialSign) noexcept : absolute(std::move(initialAbsolute)), sign(initialSign) {}
+
+    static bool isOdd(const UnsignedInteger& value) {
+        return value.digits[0] & 1;
+    }
+
+    SignedInteger& addScalar(bool valueSign, std::uint64_t valueMagnitude) {
+        if (sign == valueSign)
+            absolute.addScalar(valueMagnitude);
+        else if (absolute.compareScalar(valueMagnitude) < 0)
+            absolute = UnsignedInteger(valueMagnitude - std::uint64_t(absolute)), sign = !sign;
+        else
+            absolute.subtractScalar(valueMagnitude);
+        return sign = sign && bool(absolute), *this;
+    }
+
+    void readDecimal(std::istream& stream) {
+        const int lead = stream.rdbuf()->sgetc();
+        const bool negative = lead == '-';
+        if (negative || lead == '+')
+            stream.rdbuf()->sbumpc();
+        if (absolute.readDecimal(stream))
+            sign = negative && bool(absolute);
+    }
+
+    void writeDecimal(std::ostream& stream) const {
+        absolute.writeDecimal(stream, sign && bool(absolute));
+    }
+
+    SignedInteger& multiplyAdd(const SignedInteger& first, const SignedInteger& second, bool productSign) {
+        if (sign == productSign || !absolute)
+            return addmul(absolute, first.absolute, second.absolute), sign = productSign && bool(absolute), *this;
+        UnsignedInteger productAbsolute = first.absolute.product(second.absolute);
+        if (absolute < productAbsolute)
+            productAbsolute -= absolute, absolute = std::move(productAbsolute), sign = productSign;
+        else
+            absolute -= productAbsolute, sign = sign && bool(absolute);
+        return *this;
+    }
+
+  public:
+    friend class UnsignedInteger;
+    template <std::uint32_t>
+    friend class FixedSignedInteger;
+    SignedInteger() : absolute(), sign() {}
+
+    SignedInteger(const SignedInteger& other) : absolute(other.absolute), sign(other.sign) {}
+
+    SignedInteger(SignedInteger&& other) noexcept : absolute(std::move(other.absolute)), sign(other.sign) {}
+
+    SignedInteger(const UnsignedInteger& other) : absolute(other), sign() {}
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    SignedInteger(unsignedIntegral value) : absolute(value), sign() {}
+
+    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
+    SignedInteger(signedIntegral value) : absolute(detail::magnitude(value)), sign(value < 0) {}
+
+    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
+    SignedInteger(floatingPoint value) : absolute(std::abs(value)), sign(value < 0) {}
+
+    SignedInteger(const char* value) {
+        VALIDITY_CHECK(value, std::invalid_argument, "SignedInteger constructor error: the provided C-style string is a null pointer.")
+        VALIDITY_CHECK(*value, std::invalid_argument, "SignedInteger constructor error: the provided C-style string is empty. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
+        VALIDITY_CHECK(std::all_of(value + (*value == '-'), value + std::strlen(value), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger constructor error: the provided C-style string value = "
+                                                                                                                                                                        " + std::string(value) + "
+                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
+        absolute = value + (sign = *value == '-'), sign = sign && bool(absolute);
+    }
+
+    SignedInteger(const std::string& value) {
+        VALIDITY_CHECK(value.size(), std::invalid_argument, "SignedInteger constructor error: the provided string is empty. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
+        VALIDITY_CHECK(std::all_of(value.begin() + (value.front() == '-'), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger constructor error: the provided string value = "
+                                                                                                                                                                        " + value + "
+                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
+        absolute = value.data() + (sign = value.front() == '-'), sign = sign && bool(absolute);
+    }
+
+    ~SignedInteger() = default;
+
+    SignedInteger& operator=(const SignedInteger& other) {
+        return absolute = other.absolute, sign = other.sign, *this;
+    }
+
+    SignedInteger& operator=(SignedInteger&& other) {
+        return absolute = std::move(other.absolute), sign = other.sign, *this;
+    }
+
+    SignedInteger& operator=(const UnsignedInteger& other) {
+        return absolute = other, sign = false, *this;
+    }
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    SignedInteger& operator=(unsignedIntegral value) {
+        return absolute = value, sign = false, *this;
+    }
+
+    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
+    SignedInteger& operator=(signedIntegral value) {
+        return absolute = detail::magnitude(value), sign = value < 0, *this;
+    }
+
+    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
+    SignedInteger& operator=(floatingPoint value) {
+        return absolute = std::abs(value), sign = value < 0, *this;
+    }
+
+    SignedInteger& operator=(const char* value) {
+        VALIDITY_CHECK(value, std::invalid_argument, "SignedInteger operator= error: the provided C-style string is a null pointer.")
+        VALIDITY_CHECK(*value, std::invalid_argument, "SignedInteger operator= error: the provided C-style string is empty. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
+        VALIDITY_CHECK(std::all_of(value + (*value == '-'), value + std::strlen(value), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger operator= error: the provided C-style string value = "
+                                                                                                                                                                        " + std::string(value) + "
+                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
+        return absolute = value + (sign = *value == '-'), sign = sign && bool(absolute), *this;
+    }
+
+    SignedInteger& operator=(const std::string& value) {
+        VALIDITY_CHECK(value.size(), std::invalid_argument, "SignedInteger operator= error: the provided string is empty. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
+        VALIDITY_CHECK(std::all_of(value.begin() + (value.front() == '-'), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger operator= error: the provided string value = "
+                                                                                                                                                                        " + value + "
+                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
+        return absolute = value.data() + (sign = value.front() == '-'), sign = sign && bool(absolute), *this;
+    }
+
+    friend std::istream& operator>>(std::istream& stream, SignedInteger& destination) {
+        const std::istream::sentry guard(stream);
+        if (guard)
+            destination.readDecimal(stream);
+        return stream;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const SignedInteger& source) {
+        return source.writeDecimal(stream), stream;
+    }
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    operator unsignedIntegral() const {
+        VALIDITY_CHECK(!sign, std::invalid_argument, "SignedInteger conversion error: Cannot convert negative SignedInteger to unsigned type.")
+        return unsignedIntegral(absolute);
+    }
+
+    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
+    operator signedIntegral() const {
+        using UnsignedT = typename std::make_unsigned<signedIntegral>::type;
+        UnsignedT magnitude = static_cast<UnsignedT>(absolute);
+        if (!sign) return static_cast<signedIntegral>(magnitude);
+        UnsignedT twosComplement = UnsignedT(0) - magnitude;
+        return static_cast<signedIntegral>(twosComplement);
+    }
+
+    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
+    operator floatingPoint() const {
+        return sign ? -floatingPoint(absolute) : floatingPoint(absolute);
+    }
+
+    explicit operator const char*() const {
+        thread_local char* result = nullptr;
+        thread_local std::uint32_t resultLength = 0;
+        const char* absoluteString = static_cast<const char*>(absolute);
+        std::uint32_t absoluteLength = std::uint32_t(std::strlen(absoluteString));
+        if (resultLength < absoluteLength + 5)
+            delete[] result, result = new char[resultLength = absoluteLength + 5];
+        char* digitStart = sign && bool(absolute) ? (*result = '-', result + 1) : result;
+        std::memcpy(digitStart, absoluteString, absoluteLength), *(digitStart + absoluteLength) = 0;
+        return result;
+    }
+
+    operator std::string() const {
+        return sign && bool(absolute) ? "-" + absolute.operator std::string() : absolute.operator std::string();
+    }
+
+    std::size_t decimalLength() const noexcept {
+        return absolute.decimalLength() + (sign && bool(absolute));
+    }
+
+    char* toChars(char* first, char* last) const noexcept {
+        if (last < first || std::size_t(last - first) < decimalLength())
+            return nullptr;
+        if (sign && bool(absolute))
+            *first++ = '-';
+        return absolute.toChars(first, last);
+    }
+
+    std::size_t serializedSize() const noexcept {
+        return absolute.serializedSize();
+    }
+
+    std::uint8_t* serialize(std::uint8_t* destination) const noexcept {
+        return detail::storeLittleEndian(destination = UnsignedInteger::writeSerializedHeader(destination, sign && bool(absolute), absolute.length), absolute.digits, absolute.length), destination + (std::size_t(absolute.length) << 2);
+    }
+
+    std::vector<std::uint8_t> serialize() const {
+        std::vector<std::uint8_t> result(serializedSize());
+        return serialize(result.data()), result;
+    }
+
+    static SignedInteger deserialize(const std::uint8_t* data, std::size_t size) {
+        bool negative;
+        UnsignedInteger result = UnsignedInteger::loadSerialized(data, UnsignedInteger::readSerializedHeader(data, size, negative));
+        return SignedInteger(std::move(result), negative && bool(result));
+    }
+
+    static SignedInteger deserialize(const std::vector<std::uint8_t>& bytes) {
+        return deserialize(bytes.data(), bytes.size());
+    }
+
+    std::string toString(std::uint32_t radix) const {
+        return sign && bool(absolute) ? "-" + absolute.toString(radix) : absolute.toString(radix);
+    }
+
+    static SignedInteger fromString(const std::string& value, std::uint32_t radix) {
+        VALIDITY_CHECK(value.size(), std::invalid_argument, "SignedInteger fromString error: the provided string is empty.")
+        const bool negative = value.front() == '-';
+        UnsignedInteger result = UnsignedInteger::fromString(value.substr(negative), radix);
+        return SignedInteger(result, negative && bool(result));
+    }
+
+    operator bool() const noexcept {
+        return bool(absolute);
+    }
+
+#if __cplusplus >= 202002L
+    std::strong_ordering operator<=>(const SignedInteger& other) const {
+        return sign != other.sign ? other.sign <=> sign : (sign ? other.absolute <=> absolute : absolute <=> other.absolute);
+    }
+#endif
+
+    bool operator==(const SignedInteger& other) const {
+        return sign == other.sign && absolute == other.absolute;
+    }
+
+    bool operator!=(const SignedInteger& other) const {
+        return sign != other.sign || absolute != other.absolute;
+    }
+
+    bool operator<(const SignedInteger& other) const {
+        return sign ? !other.sign || absolute > other.absolute : !other.sign && absolute < other.absolute;
+    }
+
+    bool operator>(const SignedInteger& other) const {
+        return sign ? other.sign && absolute < other.absolute : other.sign || absolute > other.absolute;
+    }
+
+    bool operator<=(const SignedInteger& other) const {
+        return sign ? !other.sign || absolute >= other.absolute : !other.sign && absolute <= other.absolute;
+    }
+
+    bool operator>=(const SignedInteger& other) const {
+        return sign ? other.sign && absolute <= other.absolute : other.sign || absolute >= other.absolute;
+    }
+
+    SignedInteger& operator+=(const SignedInteger& other) {
+        sign == other.sign ? absolute += other.absolute : (absolute < other.absolute ? sign = !sign, absolute.reverseSubtract(other.absolute) : absolute -= other.absolute), sign = sign && bool(absolute);
+        return *this;
+    }
+
+    SignedInteger operator+(const SignedInteger& other) const& {
+        return SignedInteger(*this) += other;
+    }
+
+    SignedInteger operator+(const SignedInteger& other) && {
+        return std::move(*this += other);
+    }
+
+    SignedInteger operator+(SignedInteger&& other) const& {
+        return std::move(other += *this);
+    }
+
+    SignedInteger operator+(SignedInteger&& other) && {
+        return std::move(*this += other);
+    }
+
+    SignedInteger& operator-=(const SignedInteger& other) {
+        sign != other.sign ? absolute += other.absolute : (absolute < other.absolute ? sign = !sign, absolute.reverseSubtract(other.absolute) : absolute -= other.absolute), sign = sign && bool(absolute);
+        return *this;
+    }
+
+    SignedInteger operator-(const SignedInteger& other) const& {
+        return SignedInteger(*this) -= other;
+    }
+
+    SignedInteger operator-(const SignedInteger& other) && {
+        return std::move(*this -= other);
+    }
+
+    SignedInteger operator-(SignedInteger&& other) const& {
+        other -= *this, other.sign = !other.sign && bool(other.absolute);
+        return std::move(other);
+    }
+
+    SignedInteger operator-(SignedInteger&& other) && {
+        return std::move(*this -= other);
+    }
+
+    SignedInteger& operator*=(const SignedInteger& other) {
+        absolute *= other.absolute, sign = (sign ^ other.sign) && bool(absolute);
+        return *this;
+    }
+
+    SignedInteger operator*(const SignedInteger& other) const {
+        UnsignedInteger productAbsolute = absolute * other.absolute;
+        const bool productSign = (sign ^ other.sign) && bool(productAbsolute);
+        return SignedInteger(std::move(productAbsolute), productSign);
+    }
+
+    friend SignedInteger fma(const SignedInteger& first, const SignedInteger& second, const SignedInteger& addend) {
+        if ((first.sign ^ second.sign) == addend.sign)
+            return SignedInteger(fma(first.absolute, second.absolute, addend.absolute), addend.sign);
+        SignedInteger result(addend);
+        result.multiplyAdd(first, second, first.sign ^ second.sign);
+        return result;
+    }
+
+    friend SignedInteger& addmul(SignedInteger& accumulator, const SignedInteger& first, const SignedInteger& second) {
+        return accumulator.multiplyAdd(first, second, first.sign ^ second.sign);
+    }
+
+    friend SignedInteger& submul(SignedInteger& accumulator, const SignedInteger& first, const SignedInteger& second) {
+        return accumulator.multiplyAdd(first, second, !(first.sign ^ second.sign));
+    }
+
+    friend UnsignedInteger mulmod(const SignedInteger& first, const SignedInteger& second, const UnsignedInteger& modulus) {
+        UnsignedInteger result = mulmod(first.absolute, second.absolute, modulus);
+        if ((first.sign ^ second.sign) && result)
+            result = modulus - result;
+        return result;
+    }
+
+    SignedInteger& square() {
+        return absolute.square(), sign = false, *this;
+    }
+
+    friend SignedInteger pow(const SignedInteger& base, const UnsignedInteger& exponent) {
+        return SignedInteger(pow(base.absolute, exponent), base.sign && isOdd(exponent));
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend SignedInteger pow(const SignedInteger& base, integral exponent) {
+        return pow(base, UnsignedInteger(exponent));
+    }
+
+    friend UnsignedInteger powmod(const SignedInteger& base, const UnsignedInteger& exponent, const UnsignedInteger& modulus) {
+        UnsignedInteger result = powmod(base.absolute, exponent, modulus);
+        if (base.sign && isOdd(exponent) && result)
+            result = modulus - result;
+        return result;
+    }
+
+    friend SignedInteger gcd(const SignedInteger& first, const SignedInteger& second) {
+        return SignedInteger(gcd(first.absolute, second.absolute));
+    }
+
+    friend SignedInteger lcm(const SignedInteger& first, const SignedInteger& second) {
+        return SignedInteger(lcm(first.absolute, second.absolute));
+    }
 
-class UnsignedInteger {
-    static constexpr std::uint32_t Base = 100000000;
-    static constexpr std::uint32_t TransformLimit = 4194304;
-    static constexpr std::uint32_t BruteforceThreshold = 64;
+    friend std::tuple<UnsignedInteger, SignedInteger, SignedInteger> gcdext(const UnsignedInteger& first, const UnsignedInteger& second);
 
-    std::uint32_t *digits, length, capacity;
+    friend std::tuple<SignedInteger, SignedInteger, SignedInteger> gcdext(const SignedInteger& first, const SignedInteger& second) {
+        std::tuple<UnsignedInteger, SignedInteger, SignedInteger> result = gcdext(first.absolute, second.absolute);
+        SignedInteger &firstCofactor = std::get<1>(result), &secondCofactor = std::get<2>(result);
+        firstCofactor.sign = (firstCofactor.sign ^ first.sign) && bool(firstCofactor.absolute);
+        secondCofactor.sign = (secondCofactor.sign ^ second.sign) && bool(secondCofactor.absolute);
+        return std::make_tuple(SignedInteger(std::move(std::get<0>(result))), std::move(firstCofactor), std::move(secondCofactor));
+    }
 
-  protected:
-    UnsignedInteger(std::uint32_t initialLength, std::uint32_t initialCapacity) : digits(new std::uint32_t[initialCapacity]), length(initialLength), capacity(initialCapacity) {}
+    friend SignedInteger modinv(const SignedInteger& value, const SignedInteger& modulus) {
+        VALIDITY_CHECK(!modulus.sign, std::invalid_argument, "SignedInteger modinv error: modulus is negative.")
+        UnsignedInteger result = modinv(value.absolute % modulus.absolute, modulus.absolute);
+        if (value.sign && result)
+            result = modulus.absolute - result;
+        return SignedInteger(std::move(result));
+    }
 
-    void resize(std::uint32_t newLength) {
-        if (newLength > capacity) {
-            std::uint32_t* newMemory = reinterpret_cast<std::uint32_t*>(std::memcpy(new std::uint32_t[capacity = newLength], digits, length << 2));
-            delete[] digits, digits = newMemory;
-        }
-        length = newLength;
+    SignedInteger& operator/=(const SignedInteger& other) {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "SignedInteger division error: divisor is zero.")
+        absolute /= other.absolute, sign ^= other.sign, sign = sign && bool(absolute);
+        return *this;
     }
 
-    void construct(const char* value, std::uint32_t stringLength) {
-        std::uint32_t* currentDigit = digits + length - 1;
-        switch (stringLength & 7) {
-            case 0:
-                ++currentDigit;
-                break;
-            case 1:
-                *currentDigit = *value & 15;
-                break;
-            case 2:
-                *currentDigit = detail::I(value);
-                break;
-            case 3:
-                *currentDigit = (*value & 15) * 100 + detail::I(value + 1);
-                break;
-            case 4:
-                *currentDigit = detail::I(value) * 100 + detail::I(value + 2);
-                break;
-            case 5:
-                *currentDigit = (*value & 15) * 10000 + detail::I(value + 1) * 100 + detail::I(value + 3);
-                break;
-            case 6:
-                *currentDigit = detail::I(value) * 10000 + detail::I(value + 2) * 100 + detail::I(value + 4);
-                break;
-            case 7:
-                *currentDigit = (*value & 15) * 1000000 + detail::I(value + 1) * 10000 + detail::I(value + 3) * 100 + detail::I(value + 5);
-                break;
-        }
-        for (const char* position = value + (stringLength & 7); currentDigit != digits; *--currentDigit = detail::I(position) * 1000000 + detail::I(position + 2) * 10000 + detail::I(position + 4) * 100 + detail::I(position + 6), position += 8);
-        for (; length > 1 && !digits[length - 1]; --length);
+    SignedInteger operator/(const SignedInteger& other) const {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "SignedInteger division error: divisor is zero.")
+        UnsignedInteger quotient = std::move(absolute.divisionAndModulus(other.absolute).first);
+        const bool quotientSign = (sign ^ other.sign) && bool(quotient);
+        return SignedInteger(std::move(quotient), quotientSign);
     }
 
-    std::int32_t reverseCompare(const UnsignedInteger& other) const {
-        constexpr std::uint32_t BlockSize = 64;
-        const std::uint32_t remaining = length % BlockSize, *firstBlockPointer = digits + length - remaining, *secondBlockPointer = other.digits + length - remaining;
-        if (std::memcmp(firstBlockPointer, secondBlockPointer, remaining << 2))
-            for (const std::uint32_t *firstElementPointer = firstBlockPointer + remaining, *secondElementPointer = secondBlockPointer + remaining; firstElementPointer != firstBlockPointer;)
-                if (*--firstElementPointer != *--secondElementPointer)
-                    return std::int32_t(*firstElementPointer - *secondElementPointer);
-        while (firstBlockPointer != digits)
-            if (std::memcmp(firstBlockPointer -= BlockSize, secondBlockPointer -= BlockSize, BlockSize << 2))
-                for (const std::uint32_t *firstElementPointer = firstBlockPointer + BlockSize, *secondElementPointer = secondBlockPointer + BlockSize; firstElementPointer != firstBlockPointer;)
-                    if (*--firstElementPointer != *--secondElementPointer)
-                        return std::int32_t(*firstElementPointer - *secondElementPointer);
-        return 0;
+    SignedInteger& operator%=(const SignedInteger& other) {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "SignedInteger modulus error: modulus is zero.")
+        absolute = std::move(absolute.divisionAndModulus(other.absolute).second), sign = sign && bool(absolute);
+        return *this;
     }
 
-    std::pair<UnsignedInteger, UnsignedInteger> bruteforceDivisionAndModulus(const UnsignedInteger& divisor) const {
-        if (*this < divisor)
-            return std::make_pair(UnsignedInteger(), *this);
-        UnsignedInteger quotient(length - divisor.length + 1, length - divisor.length + 1), remainder = *this;
-        quotient.length = length - divisor.length + 1;
-        auto getEstimatedValue = [](const std::uint32_t* digitArray, std::uint32_t highIndex, std::uint32_t arrayLength) -> std::uint64_t {
-            return std::uint64_t(10) * Base * ((highIndex + 1) < arrayLength ? digitArray[highIndex + 1] : 0) + std::uint64_t(10) * digitArray[highIndex] + (highIndex ? digitArray[highIndex - 1] : 0) / (Base / 10);
-        };
-        for (std::uint32_t currentPosition = length - divisor.length; ~currentPosition; --currentPosition) {
-            std::uint32_t partialQuotient = 0;
-            auto performSubtraction = [&]() {
-                std::int64_t carry = 0;
-                for (std::uint32_t digitIndex = 0; digitIndex != divisor.length; ++digitIndex) {
-                    carry = carry - std::int64_t(partialQuotient) * divisor.digits[digitIndex] + remainder.digits[currentPosition + digitIndex];
-                    remainder.digits[currentPosition + digitIndex] = std::uint32_t(carry % Base), carry /= Base;
-                    if (remainder.digits[currentPosition + digitIndex] >= Base)
-                        remainder.digits[currentPosition + digitIndex] += Base, --carry;
-                }
-                if (carry)
-                    remainder.digits[currentPosition + divisor.length] += std::uint32_t(carry);
-                quotient.digits[currentPosition] += partialQuotient;
-            };
-            for (quotient.digits[currentPosition] = 0; (partialQuotient = std::uint32_t(getEstimatedValue(remainder.digits, currentPosition + divisor.length - 1, length) / (getEstimatedValue(divisor.digits, divisor.length - 1, divisor.length) + 1))); performSubtraction());
-            partialQuotient = 1;
-            for (std::uint32_t digitIndex = divisor.length; digitIndex--;)
-                if (remainder.digits[digitIndex + currentPosition] != divisor.digits[digitIndex] && (partialQuotient = divisor.digits[digitIndex] < remainder.digits[digitIndex + currentPosition], true))
-                    break;
-            if (partialQuotient)
-                performSubtraction();
-        }
-        for (; quotient.length > 1 && !quotient.digits[quotient.length - 1]; --quotient.length);
-        for (; remainder.length > 1 && !remainder.digits[remainder.length - 1]; --remainder.length);
-        return std::make_pair(std::move(quotient), std::move(remainder));
+    SignedInteger operator%(const SignedInteger& other) const {
+        VALIDITY_CHECK(bool(other), std::invalid_argument, "SignedInteger modulus error: modulus is zero.")
+        UnsignedInteger remainder = std::move(absolute.divisionAndModulus(other.absolute).second);
+        const bool remainderSign = sign && bool(remainder);
+        return SignedInteger(std::move(remainder), remainderSign);
     }
 
-    UnsignedInteger rightShift(std::uint32_t shiftAmount) const {
-        if (shiftAmount >= length)
-            return UnsignedInteger();
-        UnsignedInteger result(length - shiftAmount, length - shiftAmount);
-        std::memcpy(result.digits, digits + shiftAmount, result.length << 2);
-        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
-        return result;
+    friend std::pair<SignedInteger, SignedInteger> divmod(const SignedInteger& dividend, const SignedInteger& divisor) {
+        VALIDITY_CHECK(bool(divisor), std::invalid_argument, "SignedInteger divmod error: divisor is zero.")
+        std::pair<UnsignedInteger, UnsignedInteger> result = divmod(dividend.absolute, divisor.absolute);
+        const bool quotientSign = (dividend.sign ^ divisor.sign) && bool(result.first), remainderSign = dividend.sign && bool(result.second);
+        return std::make_pair(SignedInteger(std::move(result.first), quotientSign), SignedInteger(std::move(result.second), remainderSign));
     }
 
-    UnsignedInteger leftShift(std::uint32_t shiftAmount) const {
-        if (length == 0 || shiftAmount == 0)
-            return *this;
-        UnsignedInteger result(length + shiftAmount, length + shiftAmount);
-        std::memset(result.digits, 0, shiftAmount << 2), std::memcpy(result.digits + shiftAmount, digits, length << 2);
-        return result;
+    friend void divmod(const SignedInteger& dividend, const SignedInteger& divisor, SignedInteger& quotient, SignedInteger& remainder) {
+        VALIDITY_CHECK(bool(divisor), std::invalid_argument, "SignedInteger divmod error: divisor is zero.")
+        const bool quotientSign = dividend.sign ^ divisor.sign, remainderSign = dividend.sign;
+        divmod(dividend.absolute, divisor.absolute, quotient.absolute, remainder.absolute);
+        quotient.sign = quotientSign && bool(quotient.absolute), remainder.sign = remainderSign && bool(remainder.absolute);
     }
 
-    UnsignedInteger computeInverse(std::uint32_t precisionBits) const {
-        if (length < BruteforceThreshold || precisionBits < length + BruteforceThreshold) {
-            UnsignedInteger numerator(precisionBits + 1, precisionBits + 1);
-            std::memset(numerator.digits, 0, precisionBits << 2), numerator.digits[precisionBits] = 1;
-            return numerator.bruteforceDivisionAndModulus(*this).first;
-        }
-        const std::uint32_t halfPrecision = (precisionBits - length + 5) >> 1, shiftBack = halfPrecision > length ? 0 : length - halfPrecision;
-        UnsignedInteger truncated = rightShift(shiftBack);
-        const std::uint32_t newPrecision = halfPrecision + truncated.length;
-        UnsignedInteger approximateInverse = truncated.computeInverse(newPrecision);
-        UnsignedInteger result = (approximateInverse + approximateInverse).leftShift(precisionBits - newPrecision - shiftBack) - (*this * approximateInverse * approximateInverse).rightShift(2 * (newPrecision + shiftBack) - precisionBits);
-        return --result;
+    SignedInteger& shiftLeftDecimal(std::uint32_t shift) {
+        return absolute.shiftLeftDecimal(shift), *this;
     }
 
-    std::pair<UnsignedInteger, UnsignedInteger> divisionAndModulus(const UnsignedInteger& other) const {
-        if (*this < other)
-            return std::make_pair(UnsignedInteger(), *this);
-        if (length < BruteforceThreshold || other.length < BruteforceThreshold)
-            return bruteforceDivisionAndModulus(other);
-        const std::uint32_t precisionBits = length - other.length + 5, shiftBack = precisionBits > other.length ? 0 : other.length - precisionBits;
-        UnsignedInteger adjustedDivisor = other.rightShift(shiftBack);
-        if (shiftBack)
-            ++adjustedDivisor;
-        const std::uint32_t inversePrecision = precisionBits + adjustedDivisor.length;
-        UnsignedInteger quotient = (*this * adjustedDivisor.computeInverse(inversePrecision)).rightShift(inversePrecision + shiftBack);
-        while (quotient * other > *this)
-            --quotient;
-        UnsignedInteger remainder = *this - quotient * other;
-        for (; remainder >= other; ++quotient, remainder -= other);
-        return std::make_pair(std::move(quotient), std::move(remainder));
+    // Truncates toward zero, like operator/.
+    SignedInteger& shiftRightDecimal(std::uint32_t shift) {
+        absolute.shiftRightDecimal(shift), sign = sign && bool(absolute);
+        return *this;
     }
 
-  public:
-    UnsignedInteger() : digits(new std::uint32_t[1]()), length(1), capacity(1) {}
+    // The remainder takes the sign of *this, like operator%.
+    SignedInteger& modPow10(std::uint32_t shift) {
+        absolute.modPow10(shift), sign = sign && bool(absolute);
+        return *this;
+    }
 
-    UnsignedInteger(const UnsignedInteger& other) : digits(reinterpret_cast<std::uint32_t*>(std::memcpy(new std::uint32_t[other.length], other.digits, other.length << 2))), length(other.length), capacity(other.length) {}
+    std::uint32_t digitCount() const noexcept {
+        return absolute.digitCount();
+    }
 
-    UnsignedInteger(UnsignedInteger&& other) noexcept : digits(other.digits), length(other.length), capacity(other.capacity) {
-        other.digits = new std::uint32_t[other.length = other.capacity = 1]();
+    std::uint32_t digitAt(std::uint32_t position) const noexcept {
+        return absolute.digitAt(position);
     }
 
-    UnsignedInteger(const SignedInteger& other);
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger& operator+=(integral value) {
+        return addScalar(detail::isNegative(value), detail::magnitude(value));
+    }
 
-    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
-    UnsignedInteger(unsignedIntegral value) : UnsignedInteger(0, (std::numeric_limits<unsignedIntegral>::digits10 + 7) >> 3) {
-        while (digits[length++] = std::uint32_t(value) % Base, value /= unsignedIntegral(Base));
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator+(integral value) const& {
+        return SignedInteger(absolute.copyWithCapacity(3), sign) += value;
     }
 
-    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
-    UnsignedInteger(signedIntegral value) : UnsignedInteger(0, (std::numeric_limits<signedIntegral>::digits10 + 7) >> 3) {
-        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger constructor error: the provided signed integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
-        while (digits[length++] = std::uint32_t(value) % Base, value /= signedIntegral(Base));
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator+(integral value) && {
+        return std::move(*this += value);
     }
 
-    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
-    UnsignedInteger(floatingPoint value) : UnsignedInteger(0, (std::numeric_limits<floatingPoint>::max_exponent10 + 7) >> 3) {
-        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger constructor error: the provided floating point value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
-        VALIDITY_CHECK(std::isfinite(value), std::invalid_argument, "UnsignedInteger constructor error: the provided floating point value = " + std::to_string(value) + " is not finite.")
-        while (digits[length++] = std::uint32_t(std::fmod(value, Base)), (value = std::floor(value / Base)));
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend SignedInteger operator+(integral value, const SignedInteger& other) {
+        return SignedInteger(other.absolute.copyWithCapacity(3), other.sign) += value;
     }
 
-    UnsignedInteger(const char* value) {
-        VALIDITY_CHECK(value, std::invalid_argument, "UnsignedInteger constructor error: the provided C-style string is a null pointer.")
-        const std::uint32_t stringLength = std::uint32_t(std::strlen(value));
-        digits = new std::uint32_t[length = capacity = (stringLength + 7) >> 3];
-        VALIDITY_CHECK(stringLength, std::invalid_argument, "UnsignedInteger constructor error: the provided C-style string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        VALIDITY_CHECK(std::all_of(value, value + stringLength, [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger constructor error: the provided C-style string value = "
-                                                                                                                                                " + std::string(value) + "
-                                                                                                                                                " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        construct(value, stringLength);
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger& operator-=(integral value) {
+        return addScalar(!detail::isNegative(value), detail::magnitude(value));
     }
 
-    UnsignedInteger(const std::string& value) : UnsignedInteger(std::uint32_t(value.size() + 7) >> 3, std::uint32_t(value.size() + 7) >> 3) {
-        VALIDITY_CHECK(value.size(), std::invalid_argument, "UnsignedInteger constructor error: the provided string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        VALIDITY_CHECK(std::all_of(value.begin(), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger constructor error: the provided string value = "
-                                                                                                                                               " + value + "
-                                                                                                                                               " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        construct(value.data(), std::uint32_t(value.size()));
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator-(integral value) const& {
+        return SignedInteger(*this) -= value;
     }
 
-    ~UnsignedInteger() noexcept {
-        delete[] digits;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator-(integral value) && {
+        return std::move(*this -= value);
     }
 
-    UnsignedInteger& operator=(const UnsignedInteger& other) {
-        if (digits != other.digits) {
-            if (capacity < other.length)
-                delete[] digits, digits = new std::uint32_t[other.length], capacity = other.length;
-            std::memcpy(digits, other.digits, (length = other.length) << 2);
-        }
-        return *this;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend SignedInteger operator-(integral value, const SignedInteger& other) {
+        return SignedInteger(value) -= other;
     }
 
-    UnsignedInteger& operator=(UnsignedInteger&& other) noexcept {
-        if (this != &other) {
-            if (digits != other.digits) {
-                delete[] digits;
-                digits = other.digits;
-                length = other.length;
-                capacity = other.capacity;
-                other.digits = new std::uint32_t[other.length = other.capacity = 1]();
-            }
-        }
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger& operator*=(integral value) {
+        absolute.multiplyScalar(detail::magnitude(value)), sign = (sign ^ detail::isNegative(value)) && bool(absolute);
         return *this;
     }
 
-    UnsignedInteger& operator=(const SignedInteger& other);
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator*(integral value) const& {
+        return SignedInteger(absolute.copyWithCapacity(3), sign) *= value;
+    }
 
-    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
-    UnsignedInteger& operator=(unsignedIntegral value) {
-        if (length = 0, capacity < (std::numeric_limits<unsignedIntegral>::digits10 + 7) >> 3)
-            delete[] digits, digits = new std::uint32_t[capacity = (std::numeric_limits<unsignedIntegral>::digits10 + 7) >> 3];
-        while (digits[length++] = std::uint32_t(value) % Base, value /= unsignedIntegral(Base));
-        return *this;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator*(integral value) && {
+        return std::move(*this *= value);
     }
 
-    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
-    UnsignedInteger& operator=(signedIntegral value) {
-        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger operator= error: the provided signed integer value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
-        if (length = 0, capacity < (std::numeric_limits<signedIntegral>::digits10 + 7) >> 3)
-            delete[] digits, digits = new std::uint32_t[capacity = (std::numeric_limits<signedIntegral>::digits10 + 7) >> 3];
-        while (digits[length++] = std::uint32_t(value) % Base, value /= signedIntegral(Base));
-        return *this;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend SignedInteger operator*(integral value, const SignedInteger& other) {
+        return SignedInteger(other.absolute.copyWithCapacity(3), other.sign) *= value;
     }
 
-    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
-    UnsignedInteger& operator=(floatingPoint value) {
-        VALIDITY_CHECK(value >= 0, std::invalid_argument, "UnsignedInteger operator= error: the provided floating point value = " + std::to_string(value) + " is negative. UnsignedInteger can only represent non-negative integers.")
-        VALIDITY_CHECK(std::isfinite(value), std::invalid_argument, "UnsignedInteger operator= error: the provided floating point value = " + std::to_string(value) + " is not finite.")
-        if (length = 0, capacity < (std::numeric_limits<floatingPoint>::max_exponent10 + 7) >> 3)
-            delete[] digits, digits = new std::uint32_t[capacity = (std::numeric_limits<floatingPoint>::max_exponent10 + 7) >> 3];
-        while (digits[length++] = std::uint32_t(std::fmod(value, Base)), (value = std::floor(value / Base)));
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger& operator/=(integral value) {
+        VALIDITY_CHECK(value != 0, std::invalid_argument, "SignedInteger division error: divisor is zero.")
+        absolute.divideScalar(detail::magnitude(value)), sign = (sign ^ detail::isNegative(value)) && bool(absolute);
         return *this;
     }
 
-    UnsignedInteger& operator=(const char* value) {
-        VALIDITY_CHECK(value, std::invalid_argument, "UnsignedInteger operator= error: the provided C-style string is a null pointer.")
-        const std::uint32_t stringLength = std::uint32_t(std::strlen(value));
-        VALIDITY_CHECK(stringLength, std::invalid_argument, "UnsignedInteger operator= error: the provided C-style string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        VALIDITY_CHECK(std::all_of(value, value + stringLength, [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger operator= error: the provided C-style string value = "
-                                                                                                                                                " + std::string(value) + "
-                                                                                                                                                " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        if (capacity < (length = (stringLength + 7) >> 3))
-            delete[] digits, digits = new std::uint32_t[capacity = length];
-        return construct(value, stringLength), *this;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator/(integral value) const& {
+        return SignedInteger(*this) /= value;
     }
 
-    UnsignedInteger& operator=(const std::string& value) {
-        VALIDITY_CHECK(value.size(), std::invalid_argument, "UnsignedInteger operator= error: the provided string is empty. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        VALIDITY_CHECK(std::all_of(value.begin(), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "UnsignedInteger operator= error: the provided string value = "
-                                                                                                                                               " + value + "
-                                                                                                                                               " contains non-digit characters. UnsignedInteger can only be constructed from non-empty strings containing only digits.")
-        if (capacity < (length = std::uint32_t(value.size() + 7) >> 3))
-            delete[] digits, digits = new std::uint32_t[capacity = length];
-        return construct(value.data(), std::uint32_t(value.size())), *this;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator/(integral value) && {
+        return std::move(*this /= value);
     }
 
-    friend std::istream& operator>>(std::istream& stream, UnsignedInteger& destination) {
-        std::string buffer;
-        return stream >> buffer, destination = buffer, stream;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend SignedInteger operator/(integral value, const SignedInteger& other) {
+        return SignedInteger(value) / other;
     }
 
-    friend std::ostream& operator<<(std::ostream& stream, const UnsignedInteger& source) {
-        return stream << static_cast<const char*>(source);
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger& operator%=(integral value) {
+        return *this = *this % value;
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    SignedInteger operator%(integral value) const {
+        VALIDITY_CHECK(value != 0, std::invalid_argument, "SignedInteger modulus error: modulus is zero.")
+        UnsignedInteger remainder(absolute.remainderScalar(detail::magnitude(value)));
+        const bool remainderSign = sign && bool(remainder);
+        return SignedInteger(std::move(remainder), remainderSign);
+    }
+
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    friend SignedInteger operator%(integral value, const SignedInteger& other) {
+        return SignedInteger(value) % other;
+    }
+};
+
+inline SignedInteger operator""_SI(const char* literal, std::size_t) {
+    return SignedInteger(literal);
+}
+
+inline UnsignedInteger::UnsignedInteger(const SignedInteger& other) : UnsignedInteger(other.absolute) {
+    VALIDITY_CHECK(!other.sign, std::invalid_argument, "UnsignedInteger constructor error: the provided SignedInteger is negative. UnsignedInteger can only represent non-negative integers.")
+}
+
+inline UnsignedInteger& UnsignedInteger::operator=(const SignedInteger& other) {
+    VALIDITY_CHECK(!other.sign, std::invalid_argument, "UnsignedInteger operator= error: the provided SignedInteger is negative. UnsignedInteger can only represent non-negative integers.")
+    return *this = other.absolute;
+}
+
+inline std::tuple<UnsignedInteger, SignedInteger, SignedInteger> gcdext(const UnsignedInteger& first, const UnsignedInteger& second) {
+    const bool swapped = first < second;
+    UnsignedInteger::HalfGcd state(swapped ? second : first, swapped ? first : second);
+    state.reduce(0);
+    const bool firstNegative = state.odd && bool(state.matrix[3]), secondNegative = !state.odd && bool(state.matrix[1]);
+    SignedInteger firstCofactor(std::move(state.matrix[3]), firstNegative), secondCofactor(std::move(state.matrix[1]), secondNegative);
+    if (swapped)
+        std::swap(firstCofactor, secondCofactor);
+    return std::make_tuple(std::move(state.alpha), std::move(firstCofactor), std::move(secondCofactor));
+}
+
+inline UnsignedInteger modinv(const UnsignedInteger& value, const UnsignedInteger& modulus) {
+    VALIDITY_CHECK(bool(modulus), std::invalid_argument, "UnsignedInteger modinv error: modulus is zero.")
+    std::tuple<UnsignedInteger, SignedInteger, SignedInteger> result = gcdext(value % modulus, modulus);
+    VALIDITY_CHECK(!std::get<0>(result).compareScalar(1), std::invalid_argument, "UnsignedInteger modinv error: value is not invertible modulo " + std::string(modulus) + ".")
+    SignedInteger& inverse = std::get<1>(result);
+    if (inverse < SignedInteger())
+        inverse += modulus;
+    return UnsignedInteger(inverse);
+}
+
+template <std::uint32_t Limbs>
+class FixedUnsignedInteger {
+    static_assert(Limbs && Limbs <= 1024, "FixedUnsignedInteger supports between 1 and 1024 limbs.");
+
+    static constexpr std::uint32_t Base = 100000000;
+
+    std::uint32_t digits[Limbs];
+
+  protected:
+    constexpr std::uint32_t significantLimbs() const noexcept {
+        std::uint32_t count = Limbs;
+        for (; count && !digits[count - 1]; --count);
+        return count;
+    }
+
+    static constexpr int compare(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        for (std::uint32_t i = Limbs; i--;)
+            if (first.digits[i] != second.digits[i])
+                return first.digits[i] < second.digits[i] ? -1 : 1;
+        return 0;
+    }
+
+    static constexpr bool isDecimal(const char* value, std::uint32_t stringLength) noexcept {
+        for (std::uint32_t i = 0; i != stringLength; ++i)
+            if (std::uint32_t(value[i] - '0') >= 10)
+                return false;
+        return true;
+    }
+
+    static constexpr bool fitsDecimal(const char* value, std::uint32_t stringLength) noexcept {
+        for (std::uint32_t i = 0; i + (Limbs << 3) < stringLength; ++i)
+            if (value[i] != '0')
+                return false;
+        return true;
+    }
+
+    constexpr void construct(std::uint64_t value) {
+        for (std::uint32_t i = 0; i != Limbs; ++i)
+            digits[i] = std::uint32_t(value % Base), value /= Base;
+        VALIDITY_CHECK(!value, std::invalid_argument, "FixedUnsignedInteger constructor error: the provided integer value does not fit in " + std::to_string(Limbs) + " limbs.")
+    }
+
+    constexpr void construct(const char* value, std::uint32_t stringLength) {
+        VALIDITY_CHECK(stringLength, std::invalid_argument, "FixedUnsignedInteger constructor error: the provided string is empty. FixedUnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        VALIDITY_CHECK(isDecimal(value, stringLength), std::invalid_argument, "FixedUnsignedInteger constructor error: the provided string value = " + std::string(value, stringLength) + " contains non-digit characters. FixedUnsignedInteger can only be constructed from non-empty strings containing only digits.")
+        VALIDITY_CHECK(fitsDecimal(value, stringLength), std::invalid_argument, "FixedUnsignedInteger constructor error: the provided string value = " + std::string(value, stringLength) + " does not fit in " + std::to_string(Limbs) + " limbs.")
+        for (std::uint32_t i = 0, end = stringLength; end && i != Limbs; ++i) {
+            const std::uint32_t begin = end > 8 ? end - 8 : 0;
+            for (std::uint32_t position = begin; position != end; ++position)
+                digits[i] = digits[i] * 10 + std::uint32_t(value[position] - '0');
+            end = begin;
+        }
+    }
+
+    constexpr std::uint32_t divideLimb(std::uint32_t divisor) noexcept {
+        std::uint64_t remainder = 0;
+        for (std::uint32_t i = Limbs; i--;)
+            remainder = remainder * Base + digits[i], digits[i] = std::uint32_t(remainder / divisor), remainder %= divisor;
+        return std::uint32_t(remainder);
+    }
+
+    constexpr void divisionAndModulus(const FixedUnsignedInteger& divisor, FixedUnsignedInteger& quotient, FixedUnsignedInteger& remainder) const {
+        const std::uint32_t dividendLength = significantLimbs(), divisorLength = divisor.significantLimbs();
+        VALIDITY_CHECK(divisorLength, std::invalid_argument, "FixedUnsignedInteger division error: division by zero.")
+        if (dividendLength < divisorLength) {
+            remainder = *this, quotient = FixedUnsignedInteger();
+            return;
+        }
+        if (divisorLength == 1) {
+            quotient = *this, remainder = FixedUnsignedInteger(quotient.divideLimb(divisor.digits[0]));
+            return;
+        }
+        const std::uint32_t factor = Base / (divisor.digits[divisorLength - 1] + 1);
+        std::uint32_t numerator[Limbs + 1] = {}, normalized[Limbs] = {};
+        std::uint64_t carry = 0;
+        for (std::uint32_t i = 0; i != dividendLength; ++i)
+            carry += std::uint64_t(digits[i]) * factor, numerator[i] = std::uint32_t(carry % Base), carry /= Base;
+        numerator[dividendLength] = std::uint32_t(carry), carry = 0;
+        for (std::uint32_t i = 0; i != divisorLength; ++i)
+            carry += std::uint64_t(divisor.digits[i]) * factor, normalized[i] = std::uint32_t(carry % Base), carry /= Base;
+        const std::uint64_t top = normalized[divisorLength - 1], next = normalized[divisorLength - 2];
+        quotient = FixedUnsignedInteger(), remainder = FixedUnsignedInteger();
+        for (std::uint32_t j = dividendLength - divisorLength + 1; j--;) {
+            std::uint32_t* window = numerator + j;
+            const std::uint64_t leading = std::uint64_t(window[divisorLength]) * Base + window[divisorLength - 1];
+            std::uint64_t estimate = leading / top, rest = leading % top;
+            while (estimate >= Base || estimate * next > rest * Base + window[divisorLength - 2])
+                if (--estimate, (rest += top) >= Base)
+                    break;
+            std::uint64_t product = 0;
+            std::uint32_t borrow = 0;
+            for (std::uint32_t i = 0; i != divisorLength; ++i) {
+                product += estimate * normalized[i];
+                const std::uint32_t difference = window[i] - std::uint32_t(product % Base) - borrow;
+                product /= Base, borrow = difference >= Base, window[i] = difference + (borrow ? Base : 0);
+            }
+            if ((window[divisorLength] -= std::uint32_t(product) + borrow) >= Base) {
+                std::uint32_t sum = 0;
+                for (std::uint32_t i = 0; i != divisorLength; ++i)
+                    sum += window[i] + normalized[i], window[i] = sum - (sum >= Base ? Base : 0), sum = sum >= Base;
+                window[divisorLength] += sum, --estimate;
+            }
+            quotient.digits[j] = std::uint32_t(estimate);
+        }
+        for (std::uint32_t i = divisorLength; i--;)
+            carry = carry * Base + numerator[i], remainder.digits[i] = std::uint32_t(carry / factor), carry %= factor;
     }
 
+  public:
+    friend class FixedSignedInteger<Limbs>;
+
+    constexpr FixedUnsignedInteger() noexcept : digits() {}
+
     template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
-    operator unsignedIntegral() const {
-        unsignedIntegral result = 0;
-        for (std::uint32_t* i = digits + length; i != digits; result = result * unsignedIntegral(Base) + unsignedIntegral(*--i));
-        return result;
+    constexpr FixedUnsignedInteger(unsignedIntegral value) : digits() {
+        construct(value);
     }
 
     template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
-    operator signedIntegral() const {
-        using UnsignedT = typename std::make_unsigned<signedIntegral>::type;
-        UnsignedT result = 0;
-        for (std::uint32_t* i = digits + length; i != digits; result = result * UnsignedT(Base) + UnsignedT(*--i));
-        return static_cast<signedIntegral>(result);
+    constexpr FixedUnsignedInteger(signedIntegral value) : digits() {
+        VALIDITY_CHECK(value >= 0, std::invalid_argument, "FixedUnsignedInteger constructor error: the provided signed integer value = " + std::to_string(value) + " is negative. FixedUnsignedInteger can only represent non-negative integers.")
+        construct(std::uint64_t(value));
     }
 
-    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
-    operator floatingPoint() const {
-        floatingPoint result = 0;
-        for (std::uint32_t* i = digits + length; i != digits; result = result * floatingPoint(Base) + floatingPoint(*--i));
-        return result;
+    constexpr FixedUnsignedInteger(const char* value) : digits() {
+        VALIDITY_CHECK(value, std::invalid_argument, "FixedUnsignedInteger constructor error: the provided C-style string is a null pointer.")
+        std::uint32_t stringLength = 0;
+        for (; value[stringLength]; ++stringLength);
+        construct(value, stringLength);
     }
 
-    explicit operator const char*() const {
-        thread_local char* result = nullptr;
-        thread_local std::uint32_t resultLength = 0;
-        if (!length) {
-            if (resultLength < 2)
-                delete[] result, result = new char[resultLength = 2];
-            result[0] = '0';
-            result[1] = 0;
-            return result;
-        }
-        if (resultLength < (length << 3 | 7))
-            delete[] result, result = new char[resultLength = length << 3 | 7];
-        char* resultPointer = result + 8;
-        std::uint32_t *i = digits + length, numberLength = 0;
-        for (std::uint32_t number = *--i; *--resultPointer = char(48 | number % 10), ++numberLength, number /= 10;);
-        for (std::memmove(result, resultPointer, numberLength), resultPointer = result + numberLength; i-- != digits; std::memcpy(resultPointer, detail::O(*i / 10000), 4), resultPointer += 4, std::memcpy(resultPointer, detail::O(*i % 10000), 4), resultPointer += 4);
-        return *resultPointer = 0, result;
+    FixedUnsignedInteger(const std::string& value) : digits() {
+        construct(value.data(), std::uint32_t(value.size()));
+    }
+
+    explicit FixedUnsignedInteger(const UnsignedInteger& value) : digits() {
+        VALIDITY_CHECK(value.length <= Limbs || !value, std::invalid_argument, "FixedUnsignedInteger constructor error: the provided UnsignedInteger has " + std::to_string(value.length) + " limbs, more than " + std::to_string(Limbs) + ".")
+        std::memcpy(digits, value.digits, std::size_t(std::min(value.length, Limbs)) << 2);
+    }
+
+    explicit operator UnsignedInteger() const {
+        const std::uint32_t count = std::max(significantLimbs(), 1u);
+        UnsignedInteger result(count, count);
+        return std::memcpy(result.digits, digits, std::size_t(count) << 2), result;
     }
 
-    operator std::string() const {
-        if (!length)
-            return "0";
-        std::uint32_t* i = digits + length;
-        std::string result = std::to_string(*--i);
-        for (result.reserve(length << 3); i-- != digits; result.append(detail::O(*i / 10000), 4), result.append(detail::O(*i % 10000), 4));
+    constexpr explicit operator bool() const noexcept {
+        return significantLimbs();
+    }
+
+    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
+    constexpr explicit operator unsignedIntegral() const noexcept {
+        unsignedIntegral result = 0;
+        for (std::uint32_t i = significantLimbs(); i--; result = unsignedIntegral(result * unsignedIntegral(Base) + unsignedIntegral(digits[i])));
         return result;
     }
 
-    operator bool() const noexcept {
-        return length != 1 || *digits;
+    constexpr const std::uint32_t* data() const noexcept {
+        return digits;
     }
 
-#if __cplusplus >= 202002L
-    std::strong_ordering operator<=>(const UnsignedInteger& other) const {
-        return length == other.length ? reverseCompare(other) <=> 0 : length <=> other.length;
+    static constexpr std::uint32_t limbs() noexcept {
+        return Limbs;
     }
-#endif
 
-    bool operator==(const UnsignedInteger& other) const {
-        return length == other.length && !std::memcmp(digits, other.digits, length << 2);
+    std::size_t decimalLength() const noexcept {
+        const std::uint32_t count = significantLimbs();
+        std::size_t result = count ? std::size_t(count - 1) << 3 | 1 : 1;
+        for (std::uint32_t number = count ? digits[count - 1] : 0; number >= 10; number /= 10, ++result);
+        return result;
     }
 
-    bool operator!=(const UnsignedInteger& other) const {
-        return length != other.length || std::memcmp(digits, other.digits, length << 2);
+    char* toChars(char* first, char* last) const noexcept {
+        if (last < first || std::size_t(last - first) < decimalLength())
+            return nullptr;
+        const std::uint32_t count = significantLimbs();
+        char buffer[8], *start = buffer + 8;
+        for (std::uint32_t number = count ? digits[count - 1] : 0; *--start = char(48 | number % 10), number /= 10;);
+        char* position = static_cast<char*>(std::memcpy(first, start, std::size_t(buffer + 8 - start))) + (buffer + 8 - start);
+        for (std::uint32_t i = count ? count - 1 : 0; i--; position += 8)
+            std::memcpy(position, detail::O(digits[i] / 10000), 4), std::memcpy(position + 4, detail::O(digits[i] % 10000), 4);
+        return position;
     }
 
-    bool operator<(const UnsignedInteger& other) const {
-        return length < other.length || (length == other.length && reverseCompare(other) < 0);
+    explicit operator std::string() const {
+        std::string result(decimalLength(), '0');
+        toChars(&result[0], &result[0] + result.size());
+        return result;
     }
 
-    bool operator>(const UnsignedInteger& other) const {
-        return length > other.length || (length == other.length && reverseCompare(other) > 0);
+    friend std::istream& operator>>(std::istream& stream, FixedUnsignedInteger& destination) {
+        UnsignedInteger value;
+        if (stream >> value)
+            destination = FixedUnsignedInteger(value);
+        return stream;
     }
 
-    bool operator<=(const UnsignedInteger& other) const {
-        return length < other.length || (length == other.length && reverseCompare(other) <= 0);
+    friend std::ostream& operator<<(std::ostream& stream, const FixedUnsignedInteger& source) {
+        char buffer[(Limbs << 3) + 1];
+        *source.toChars(buffer, buffer + (Limbs << 3)) = '\0';
+        return stream << static_cast<const char*>(buffer);
     }
 
-    bool operator>=(const UnsignedInteger& other) const {
-        return length > other.length || (length == other.length && reverseCompare(other) >= 0);
+    friend constexpr bool operator==(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        return !compare(first, second);
     }
 
-    UnsignedInteger& operator+=(const UnsignedInteger& other) {
-        if (length <= other.length) {
-            const std::uint32_t oldLength = length;
-            resize(other.length + 1), std::memset(digits + oldLength, 0, (length - oldLength) << 2);
+    friend constexpr bool operator!=(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        return compare(first, second);
+    }
+
+    friend constexpr bool operator<(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        return compare(first, second) < 0;
+    }
+
+    friend constexpr bool operator>(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        return compare(first, second) > 0;
+    }
+
+    friend constexpr bool operator<=(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        return compare(first, second) <= 0;
+    }
+
+    friend constexpr bool operator>=(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) noexcept {
+        return compare(first, second) >= 0;
+    }
+
+    constexpr FixedUnsignedInteger& operator+=(const FixedUnsignedInteger& other) {
+        std::uint32_t carry = 0;
+        for (std::uint32_t i = 0; i != Limbs; ++i) {
+            const std::uint32_t sum = digits[i] + other.digits[i] + carry;
+            carry = sum >= Base, digits[i] = sum - (carry ? Base : 0);
         }
-        std::uint32_t *thisDigit = digits, *thisEnd = digits + length - 1;
-        for (std::uint32_t *otherDigit = other.digits, *otherEnd = other.digits + other.length; otherDigit != otherEnd; ++thisDigit, ++otherDigit)
-            if ((*thisDigit += *otherDigit) >= Base)
-                *thisDigit -= Base, ++*(thisDigit + 1);
-        for (; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit -= Base, ++*++thisDigit);
-        for (; length > 1 && !digits[length - 1]; --length);
+        VALIDITY_CHECK(!carry, std::invalid_argument, "FixedUnsignedInteger addition error: the sum does not fit in " + std::to_string(Limbs) + " limbs.")
         return *this;
     }
 
-    UnsignedInteger operator+(const UnsignedInteger& other) const {
-        return UnsignedInteger(*this) += other;
+    friend constexpr FixedUnsignedInteger operator+(FixedUnsignedInteger first, const FixedUnsignedInteger& second) {
+        return first += second;
     }
 
-    UnsignedInteger& operator++() {
-        std::uint32_t *thisDigit = digits, *thisEnd = digits + length - 1;
-        for (++*thisDigit; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit -= Base, ++*++thisDigit);
-        if (thisDigit == thisEnd && *thisDigit >= Base)
-            resize(length + 1), digits[length - 2] -= Base, digits[length - 1] = 1;
-        return *this;
+    constexpr FixedUnsignedInteger& operator++() {
+        return *this += FixedUnsignedInteger(1u);
     }
 
-    UnsignedInteger operator++(int) {
-        UnsignedInteger result = *this;
+    constexpr FixedUnsignedInteger operator++(int) {
+        FixedUnsignedInteger result = *this;
         return ++*this, result;
     }
 
-    UnsignedInteger& operator-=(const UnsignedInteger& other) {
-        VALIDITY_CHECK(
-            *this >= other,
-            std::invalid_argument,
-            std::string("UnsignedInteger subtraction error: attempted to subtract a larger UnsignedInteger ") +
-                other.operator std::string() +
-                " from a smaller one " +
-                this->operator std::string() +
-                ".")
-        std::uint32_t *thisDigit = digits, *thisEnd = digits + length;
-        for (std::uint32_t *otherDigit = other.digits, *otherEnd = other.digits + other.length; otherDigit != otherEnd; ++thisDigit, ++otherDigit)
-            if ((*thisDigit -= *otherDigit) >= Base)
-                *thisDigit += Base, --*(thisDigit + 1);
-        for (; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit += Base, --*++thisDigit);
-        for (; length > 1 && !digits[length - 1]; --length);
+    constexpr FixedUnsignedInteger& operator-=(const FixedUnsignedInteger& other) {
+        std::uint32_t borrow = 0;
+        for (std::uint32_t i = 0; i != Limbs; ++i) {
+            const std::uint32_t difference = digits[i] - other.digits[i] - borrow;
+            borrow = difference >= Base, digits[i] = difference + (borrow ? Base : 0);
+        }
+        VALIDITY_CHECK(!borrow, std::invalid_argument, "FixedUnsignedInteger subtraction error: attempted to subtract a larger FixedUnsignedInteger from a smaller one.")
         return *this;
     }
 
-    UnsignedInteger operator-(const UnsignedInteger& other) const {
-        return UnsignedInteger(*this) -= other;
+    friend constexpr FixedUnsignedInteger operator-(FixedUnsignedInteger first, const FixedUnsignedInteger& second) {
+        return first -= second;
     }
 
-    UnsignedInteger& operator--() {
-        VALIDITY_CHECK(bool(*this), std::invalid_argument, "UnsignedInteger decrement error: value is already zero.")
-        std::uint32_t *thisDigit = digits, *thisEnd = digits + length - 1;
-        for (--*thisDigit; thisDigit != thisEnd && *thisDigit >= Base; *thisDigit += Base, --*++thisDigit);
-        return *this;
+    constexpr FixedUnsignedInteger& operator--() {
+        return *this -= FixedUnsignedInteger(1u);
     }
 
-    UnsignedInteger operator--(int) {
-        UnsignedInteger result = *this;
+    constexpr FixedUnsignedInteger operator--(int) {
+        FixedUnsignedInteger result = *this;
         return --*this, result;
     }
 
-    UnsignedInteger& operator*=(const UnsignedInteger& other) {
-        if (length < BruteforceThreshold || other.length < BruteforceThreshold) {
-            UnsignedInteger result(length + other.length - 1, length + other.length);
-            std::uint64_t carry = 0;
-            for (std::uint32_t i = 0; i != result.length; result.digits[i++] = std::uint32_t(carry % Base), carry /= Base)
-                for (std::uint32_t j = (i >= length ? i - length + 1 : 0); j <= i && j < other.length; ++j)
-                    carry += std::uint64_t(digits[i - j]) * other.digits[j];
-            if (carry)
-                result.digits[result.length] = std::uint32_t(carry), ++result.length;
-            for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
-            return *this = std::move(result);
-        }
-        VALIDITY_CHECK(length <= TransformLimit, std::invalid_argument, "UnsignedInteger multiplication error: left operand length (" + std::to_string(length) + ") exceeds Transform limit (" + std::to_string(TransformLimit) + ").")
-        VALIDITY_CHECK(other.length <= TransformLimit, std::invalid_argument, "UnsignedInteger multiplication error: right operand length (" + std::to_string(other.length) + ") exceeds Transform limit (" + std::to_string(TransformLimit) + ").")
-#if defined(__AVX2__) || defined(__ARM_NEON__)
-        const std::uint32_t resultLength = length + other.length, transformLength = 2u << detail::log2(resultLength - 1);
-#if defined(__AVX2__)
-        thread_local __m128d *firstArray = nullptr, *secondArray = nullptr;
-        thread_local std::uint32_t allocatedSize = 0;
-        if (allocatedSize < transformLength)
-            delete[] firstArray, delete[] secondArray, firstArray = new __m128d[transformLength](), secondArray = new __m128d[transformLength](), allocatedSize = transformLength;
-        std::memset(firstArray, 0, transformLength * sizeof(__m128d)), std::memset(secondArray, 0, transformLength * sizeof(__m128d));
-        for (std::uint32_t i = 0; i != length; ++i)
-            firstArray[i] = _mm_set_pd(std::floor(static_cast<double>(digits[i]) / 10000.0), static_cast<double>(digits[i] % 10000u));
-        for (std::uint32_t i = 0; i != other.length; ++i)
-            secondArray[i] = _mm_set_pd(std::floor(static_cast<double>(other.digits[i]) / 10000.0), static_cast<double>(other.digits[i] % 10000u));
-        detail::T.resize(transformLength), detail::T.decimationInFrequency(firstArray, transformLength), detail::T.decimationInFrequency(secondArray, transformLength);
-        detail::T.frequencyDomainPointwiseMultiply(firstArray, secondArray, transformLength), detail::T.decimationInTime(firstArray, transformLength);
-#else
-        thread_local float64x2_t *firstArray = nullptr, *secondArray = nullptr;
-        thread_local std::uint32_t allocatedSize = 0;
-        if (allocatedSize < transformLength)
-            delete[] firstArray, delete[] secondArray, firstArray = new float64x2_t[transformLength](), secondArray = new float64x2_t[transformLength](), allocatedSize = transformLength;
-        std::memset(firstArray, 0, transformLength * sizeof(float64x2_t)), std::memset(secondArray, 0, transformLength * sizeof(float64x2_t));
-        for (std::uint32_t i = 0; i != length; ++i) {
-            float64x2_t v = vdupq_n_f64(0.0);
-            v = vsetq_lane_f64(static_cast<double>(digits[i] % 10000u), v, 0);
-            v = vsetq_lane_f64(std::floor(static_cast<double>(digits[i]) / 10000.0), v, 1);
-            firstArray[i] = v;
-        }
-        for (std::uint32_t i = 0; i != other.length; ++i) {
-            float64x2_t v = vdupq_n_f64(0.0);
-            v = vsetq_lane_f64(static_cast<double>(other.digits[i] % 10000u), v, 0);
-            v = vsetq_lane_f64(std::floor(static_cast<double>(other.digits[i]) / 10000.0), v, 1);
-            secondArray[i] = v;
-        }
-        detail::T.resize(transformLength), detail::T.decimationInFrequency(firstArray, transformLength), detail::T.decimationInFrequency(secondArray, transformLength);
-        detail::T.frequencyDomainPointwiseMultiply(firstArray, secondArray, transformLength), detail::T.decimationInTime(firstArray, transformLength);
-#endif
-        UnsignedInteger result(resultLength, resultLength);
+    friend constexpr FixedUnsignedInteger operator*(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) {
+        const std::uint32_t firstLength = first.significantLimbs(), secondLength = second.significantLimbs();
+        FixedUnsignedInteger result;
+        if (!firstLength || !secondLength)
+            return result;
+        const std::uint32_t columns = firstLength + secondLength - 1 < Limbs ? firstLength + secondLength - 1 : Limbs;
         std::uint64_t carry = 0;
-#if defined(__AVX2__)
-        for (std::uint32_t i = 0; i != resultLength; ++i) {
-            __m128d v = firstArray[i];
-            double realPart = _mm_cvtsd_f64(v);
-            double imagPart = _mm_cvtsd_f64(_mm_unpackhi_pd(v, v));
-            carry += std::uint64_t(std::int64_t(realPart + 0.5) + std::int64_t(imagPart + 0.5) * 10000);
-            result.digits[i] = std::uint32_t(carry % Base), carry /= Base;
-        }
-#else
-        for (std::uint32_t i = 0; i != resultLength; ++i) {
-            float64x2_t v = firstArray[i];
-            double realPart = vgetq_lane_f64(v, 0);
-            double imagPart = vgetq_lane_f64(v, 1);
-            carry += std::uint64_t(std::int64_t(realPart + 0.5) + std::int64_t(imagPart + 0.5) * 10000);
-            result.digits[i] = std::uint32_t(carry % Base), carry /= Base;
+        std::uint32_t k = 0;
+        for (; k != columns; ++k) {
+            for (std::uint32_t i = k >= secondLength ? k - secondLength + 1 : 0; i <= k && i < firstLength; ++i)
+                carry += std::uint64_t(first.digits[i]) * second.digits[k - i];
+            result.digits[k] = std::uint32_t(carry % Base), carry /= Base;
         }
-#endif
-#else
-        thread_local std::complex<double>*firstArray = nullptr, *secondArray = nullptr;
-        thread_local std::uint32_t allocatedSize = 0;
-        const std::uint32_t resultLength = length + other.length, transformLength = 2u << detail::log2(resultLength - 1);
-        if (allocatedSize < transformLength)
-            delete[] firstArray, delete[] secondArray, firstArray = new std::complex<double>[transformLength](), secondArray = new std::complex<double>[transformLength](), allocatedSize = transformLength;
-        std::memset(firstArray, 0, transformLength * sizeof(std::complex<double>)), std::memset(secondArray, 0, transformLength * sizeof(std::complex<double>));
-        for (std::uint32_t i = 0; i != length; ++i)
-            firstArray[i] = {static_cast<double>(digits[i] % 10000u), std::floor(static_cast<double>(digits[i]) / 10000.0)};
-        for (std::uint32_t i = 0; i != other.length; ++i)
-            secondArray[i] = {static_cast<double>(other.digits[i] % 10000u), std::floor(static_cast<double>(other.digits[i]) / 10000.0)};
-        detail::T.resize(transformLength), detail::T.decimationInFrequency(firstArray, transformLength), detail::T.decimationInFrequency(secondArray, transformLength);
-        detail::T.frequencyDomainPointwiseMultiply(firstArray, secondArray, transformLength), detail::T.decimationInTime(firstArray, transformLength);
-        UnsignedInteger result(resultLength, resultLength);
+        for (; carry && k != Limbs; ++k)
+            result.digits[k] = std::uint32_t(carry % Base), carry /= Base;
+        VALIDITY_CHECK(!carry && firstLength + secondLength - 1 <= Limbs, std::invalid_argument, "FixedUnsignedInteger multiplication error: the product does not fit in " + std::to_string(Limbs) + " limbs.")
+        return result;
+    }
+
+    constexpr FixedUnsignedInteger& operator*=(const FixedUnsignedInteger& other) {
+        return *this = *this * other;
+    }
+
+    constexpr FixedUnsignedInteger& square() {
+        const std::uint32_t length = significantLimbs();
+        if (!length)
+            return *this;
+        const std::uint32_t columns = 2 * length - 1 < Limbs ? 2 * length - 1 : Limbs;
+        FixedUnsignedInteger result;
         std::uint64_t carry = 0;
-        for (std::uint32_t i = 0; i != resultLength; ++i) {
-            carry += std::uint64_t(std::int64_t(firstArray[i].real() + 0.5) + std::int64_t(firstArray[i].imag() + 0.5) * 10000);
-            result.digits[i] = std::uint32_t(carry % Base), carry /= Base;
+        std::uint32_t k = 0;
+        for (; k != columns; ++k) {
+            std::uint64_t crossTerms = 0;
+            for (std::uint32_t i = k >= length ? k - length + 1 : 0; i < k - i; ++i)
+                crossTerms += std::uint64_t(digits[i]) * digits[k - i];
+            carry += crossTerms << 1;
+            if (!(k & 1))
+                carry += std::uint64_t(digits[k >> 1]) * digits[k >> 1];
+            result.digits[k] = std::uint32_t(carry % Base), carry /= Base;
         }
-#endif
-        for (; carry && result.length != result.capacity; result.digits[result.length++] = std::uint32_t(carry % Base), carry /= Base)
-            if (result.length == result.capacity)
-                result.resize(result.capacity << 1);
-        for (; result.length > 1 && !result.digits[result.length - 1]; --result.length);
-        return *this = std::move(result);
+        for (; carry && k != Limbs; ++k)
+            result.digits[k] = std::uint32_t(carry % Base), carry /= Base;
+        VALIDITY_CHECK(!carry && 2 * length - 1 <= Limbs, std::invalid_argument, "FixedUnsignedInteger multiplication error: the square does not fit in " + std::to_string(Limbs) + " limbs.")
+        return *this = result;
     }
 
-    UnsignedInteger operator*(const UnsignedInteger& other) const {
-        return UnsignedInteger(*this) *= other;
+    friend constexpr FixedUnsignedInteger operator/(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) {
+        FixedUnsignedInteger quotient, remainder;
+        return first.divisionAndModulus(second, quotient, remainder), quotient;
     }
 
-    UnsignedInteger& operator/=(const UnsignedInteger& other) {
-        VALIDITY_CHECK(bool(other), std::invalid_argument, "UnsignedInteger division error: divisor is zero.")
-        return *this = std::move(divisionAndModulus(other).first);
+    constexpr FixedUnsignedInteger& operator/=(const FixedUnsignedInteger& other) {
+        return *this = *this / other;
     }
 
-    UnsignedInteger operator/(const UnsignedInteger& other) const {
-        return UnsignedInteger(*this) /= other;
+    friend constexpr FixedUnsignedInteger operator%(const FixedUnsignedInteger& first, const FixedUnsignedInteger& second) {
+        FixedUnsignedInteger quotient, remainder;
+        return first.divisionAndModulus(second, quotient, remainder), remainder;
     }
 
-    UnsignedInteger& operator%=(const UnsignedInteger& other) {
-        VALIDITY_CHECK(bool(other), std::invalid_argument, "UnsignedInteger modulus error: modulus is zero.")
-        return *this = std::move(divisionAndModulus(other).second);
+    constexpr FixedUnsignedInteger& operator%=(const FixedUnsignedInteger& other) {
+        return *this = *this % other;
     }
 
-    UnsignedInteger operator%(const UnsignedInteger& other) const {
-        return UnsignedInteger(*this) %= other;
+    friend constexpr void divmod(const FixedUnsignedInteger& dividend, const FixedUnsignedInteger& divisor, FixedUnsignedInteger& quotient, FixedUnsignedInteger& remainder) {
+        dividend.divisionAndModulus(divisor, quotient, remainder);
     }
 };
 
-inline UnsignedInteger operator""_UI(const char* literal, std::size_t) {
-    return UnsignedInteger(literal);
-}
-
-class SignedInteger {
-    UnsignedInteger absolute;
+template <std::uint32_t Limbs>
+class FixedSignedInteger {
+    FixedUnsignedInteger<Limbs> absolute;
     bool sign;
 
   protected:
-    SignedInteger(const UnsignedInteger& initialAbsolute, bool initialSign) : absolute(initialAbsolute), sign(initialSign) {}
-
-  public:
-    friend class UnsignedInteger;
-    SignedInteger() : absolute(), sign() {}
+    constexpr FixedSignedInteger(const FixedUnsignedInteger<Limbs>& initialAbsolute, bool initialSign) noexcept : absolute(initialAbsolute), sign(initialSign && bool(initialAbsolute)) {}
 
-    SignedInteger(const SignedInteger& other) : absolute(other.absolute), sign(other.sign) {}
+    static constexpr int compare(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        if (first.sign != second.sign)
+            return first.sign ? -1 : 1;
+        return first.sign ? FixedUnsignedInteger<Limbs>::compare(second.absolute, first.absolute) : FixedUnsignedInteger<Limbs>::compare(first.absolute, second.absolute);
+    }
 
-    SignedInteger(SignedInteger&& other) noexcept : absolute(std::move(other.absolute)), sign(other.sign) {}
+  public:
+    constexpr FixedSignedInteger() noexcept : absolute(), sign() {}
 
-    SignedInteger(const UnsignedInteger& other) : absolute(other), sign() {}
+    constexpr FixedSignedInteger(const FixedUnsignedInteger<Limbs>& value) noexcept : absolute(value), sign() {}
 
-    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
-    SignedInteger(unsignedIntegral value) : absolute(value), sign() {}
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    constexpr FixedSignedInteger(integral value) : absolute(detail::magnitude(value)), sign(detail::isNegative(value)) {}
 
-    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
-    SignedInteger(signedIntegral value) : absolute(std::abs(value)), sign(value < 0) {}
+    constexpr FixedSignedInteger(const char* value) : absolute(value && *value == '-' ? value + 1 : value), sign(value && *value == '-') {
+        sign = sign && bool(absolute);
+    }
 
-    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
-    SignedInteger(floatingPoint value) : absolute(std::abs(value)), sign(value < 0) {}
+    FixedSignedInteger(const std::string& value) : FixedSignedInteger(value.c_str()) {}
 
-    SignedInteger(const char* value) {
-        VALIDITY_CHECK(value, std::invalid_argument, "SignedInteger constructor error: the provided C-style string is a null pointer.")
-        VALIDITY_CHECK(*value, std::invalid_argument, "SignedInteger constructor error: the provided C-style string is empty. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
-        VALIDITY_CHECK(std::all_of(value + (*value == '-'), value + std::strlen(value), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger constructor error: the provided C-style string value = "
-                                                                                                                                                                        " + std::string(value) + "
-                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
-        absolute = value + (sign = *value == '-'), sign = sign && bool(absolute);
-    }
+    explicit FixedSignedInteger(const SignedInteger& value) : absolute(value.absolute), sign(value.sign) {}
 
-    SignedInteger(const std::string& value) {
-        VALIDITY_CHECK(value.size(), std::invalid_argument, "SignedInteger constructor error: the provided string is empty. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
-        VALIDITY_CHECK(std::all_of(value.begin() + (value.front() == '-'), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger constructor error: the provided string value = "
-                                                                                                                                                                        " + value + "
-                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be constructed from non-empty strings containing only digits (optionally prefixed with '-').")
-        absolute = value.data() + (sign = value.front() == '-'), sign = sign && bool(absolute);
+    explicit operator SignedInteger() const {
+        return SignedInteger(UnsignedInteger(absolute), sign);
     }
 
-    ~SignedInteger() = default;
-
-    SignedInteger& operator=(const SignedInteger& other) {
-        return absolute = other.absolute, sign = other.sign, *this;
+    constexpr explicit operator bool() const noexcept {
+        return bool(absolute);
     }
 
-    SignedInteger& operator=(SignedInteger&& other) noexcept {
-        return absolute = std::move(other.absolute), sign = other.sign, *this;
+    template <typename integral, typename std::enable_if<std::is_integral<integral>::value>::type* = nullptr>
+    constexpr explicit operator integral() const noexcept {
+        using UnsignedT = typename std::make_unsigned<integral>::type;
+        const UnsignedT magnitude = static_cast<UnsignedT>(absolute);
+        return static_cast<integral>(sign ? UnsignedT(UnsignedT(0) - magnitude) : magnitude);
     }
 
-    SignedInteger& operator=(const UnsignedInteger& other) {
-        return absolute = other, sign = false, *this;
+    constexpr const FixedUnsignedInteger<Limbs>& magnitude() const noexcept {
+        return absolute;
     }
 
-    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
-    SignedInteger& operator=(unsignedIntegral value) {
-        return absolute = value, sign = false, *this;
+    constexpr bool negative() const noexcept {
+        return sign;
     }
 
-    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
-    SignedInteger& operator=(signedIntegral value) {
-        return absolute = std::abs(value), sign = value < 0, *this;
+    std::size_t decimalLength() const noexcept {
+        return absolute.decimalLength() + sign;
     }
 
-    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
-    SignedInteger& operator=(floatingPoint value) {
-        return absolute = std::abs(value), sign = value < 0, *this;
+    char* toChars(char* first, char* last) const noexcept {
+        if (last < first || std::size_t(last - first) < decimalLength())
+            return nullptr;
+        if (sign)
+            *first++ = '-';
+        return absolute.toChars(first, last);
     }
 
-    SignedInteger& operator=(const char* value) {
-        VALIDITY_CHECK(value, std::invalid_argument, "SignedInteger operator= error: the provided C-style string is a null pointer.")
-        VALIDITY_CHECK(*value, std::invalid_argument, "SignedInteger operator= error: the provided C-style string is empty. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
-        VALIDITY_CHECK(std::all_of(value + (*value == '-'), value + std::strlen(value), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger operator= error: the provided C-style string value = "
-                                                                                                                                                                        " + std::string(value) + "
-                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
-        return absolute = value + (sign = *value == '-'), sign = sign && bool(absolute), *this;
+    explicit operator std::string() const {
+        return sign ? '-' + std::string(absolute) : std::string(absolute);
     }
 
-    SignedInteger& operator=(const std::string& value) {
-        VALIDITY_CHECK(value.size(), std::invalid_argument, "SignedInteger operator= error: the provided string is empty. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
-        VALIDITY_CHECK(std::all_of(value.begin() + (value.front() == '-'), value.end(), [](char digit) -> bool { return std::isdigit(digit); }), std::invalid_argument, "SignedInteger operator= error: the provided string value = "
-                                                                                                                                                                        " + value + "
-                                                                                                                                                                        " contains non-digit characters. SignedInteger can only be assigned from non-empty strings containing only digits (optionally prefixed with '-').")
-        return absolute = value.data() + (sign = value.front() == '-'), sign = sign && bool(absolute), *this;
+    friend std::istream& operator>>(std::istream& stream, FixedSignedInteger& destination) {
+        SignedInteger value;
+        if (stream >> value)
+            destination = FixedSignedInteger(value);
+        return stream;
     }
 
-    friend std::istream& operator>>(std::istream& stream, SignedInteger& destination) {
-        std::string buffer;
-        return stream >> buffer, destination = buffer, stream;
+    friend std::ostream& operator<<(std::ostream& stream, const FixedSignedInteger& source) {
+        char buffer[(Limbs << 3) + 2];
+        *source.toChars(buffer, buffer + (Limbs << 3) + 1) = '\0';
+        return stream << static_cast<const char*>(buffer);
     }
 
-    friend std::ostream& operator<<(std::ostream& stream, const SignedInteger& source) {
-        return stream << static_cast<const char*>(source);
+    friend constexpr bool operator==(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        return !compare(first, second);
     }
 
-    template <typename unsignedIntegral, typename std::enable_if<std::is_unsigned<unsignedIntegral>::value>::type* = nullptr>
-    operator unsignedIntegral() const {
-        VALIDITY_CHECK(!sign, std::invalid_argument, "SignedInteger conversion error: Cannot convert negative SignedInteger to unsigned type.")
-        return unsignedIntegral(absolute);
+    friend constexpr bool operator!=(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        return compare(first, second);
     }
 
-    template <typename signedIntegral, typename std::enable_if<std::is_signed<signedIntegral>::value && !std::is_floating_point<signedIntegral>::value>::type* = nullptr>
-    operator signedIntegral() const {
-        using UnsignedT = typename std::make_unsigned<signedIntegral>::type;
-        UnsignedT magnitude = static_cast<UnsignedT>(absolute);
-        if (!sign) return static_cast<signedIntegral>(magnitude);
-        UnsignedT twosComplement = UnsignedT(0) - magnitude;
-        return static_cast<signedIntegral>(twosComplement);
+    friend constexpr bool operator<(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        return compare(first, second) < 0;
     }
 
-    template <typename floatingPoint, typename std::enable_if<std::is_floating_point<floatingPoint>::value>::type* = nullptr>
-    operator floatingPoint() const {
-        return sign ? -floatingPoint(absolute) : floatingPoint(absolute);
+    friend constexpr bool operator>(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        return compare(first, second) > 0;
     }
 
-    explicit operator const char*() const {
-        thread_local char* result = nullptr;
-        thread_local std::uint32_t resultLength = 0;
-        const char* absoluteString = static_cast<const char*>(absolute);
-        std::uint32_t absoluteLength = std::uint32_t(std::strlen(absoluteString));
-        if (resultLength < absoluteLength + 5)
-            delete[] result, result = new char[resultLength = absoluteLength + 5];
-        char* digitStart = sign && bool(absolute) ? (*result = '-', result + 1) : result;
-        std::memcpy(digitStart, absoluteString, absoluteLength), *(digitStart + absoluteLength) = 0;
-        return result;
+    friend constexpr bool operator<=(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        return compare(first, second) <= 0;
     }
 
-    operator std::string() const {
-        return sign && bool(absolute) ? "-" + absolute.operator std::string() : absolute.operator std::string();
+    friend constexpr bool operator>=(const FixedSignedInteger& first, const FixedSignedInteger& second) noexcept {
+        return compare(first, second) >= 0;
     }
 
-    operator bool() const noexcept {
-        return bool(absolute);
+    constexpr FixedSignedInteger operator+() const noexcept {
+        return *this;
     }
 
-#if __cplusplus >= 202002L
-    std::strong_ordering operator<=>(const SignedInteger& other) const {
-        return sign != other.sign ? other.sign <=> sign : (sign ? other.absolute <=> absolute : absolute <=> other.absolute);
+    constexpr FixedSignedInteger operator-() const noexcept {
+        return FixedSignedInteger(absolute, !sign);
     }
-#endif
 
-    bool operator==(const SignedInteger& other) const {
-        return sign == other.sign && absolute == other.absolute;
+    constexpr FixedSignedInteger& operator+=(const FixedSignedInteger& other) {
+        if (sign == other.sign)
+            absolute += other.absolute;
+        else if (absolute >= other.absolute)
+            absolute -= other.absolute;
+        else
+            absolute = other.absolute - absolute, sign = other.sign;
+        return sign = sign && bool(absolute), *this;
     }
 
-    bool operator!=(const SignedInteger& other) const {
-        return sign != other.sign || absolute != other.absolute;
+    friend constexpr FixedSignedInteger operator+(FixedSignedInteger first, const FixedSignedInteger& second) {
+        return first += second;
     }
 
-    bool operator<(const SignedInteger& other) const {
-        return sign ? !other.sign || absolute > other.absolute : !other.sign && absolute < other.absolute;
+    constexpr FixedSignedInteger& operator-=(const FixedSignedInteger& other) {
+        return *this += -other;
     }
 
-    bool operator>(const SignedInteger& other) const {
-        return sign ? other.sign && absolute < other.absolute : other.sign || absolute > other.absolute;
+    friend constexpr FixedSignedInteger operator-(FixedSignedInteger first, const FixedSignedInteger& second) {
+        return first -= second;
     }
 
-    bool operator<=(const SignedInteger& other) const {
-        return sign ? !other.sign || absolute >= other.absolute : !other.sign && absolute <= other.absolute;
+    constexpr FixedSignedInteger& operator++() {
+        return *this += FixedSignedInteger(1);
     }
 
-    bool operator>=(const SignedInteger& other) const {
-        return sign ? other.sign && absolute <= other.absolute : other.sign || absolute >= other.absolute;
+    constexpr FixedSignedInteger operator++(int) {
+        FixedSignedInteger result = *this;
+        return ++*this, result;
     }
 
-    SignedInteger& operator+=(const SignedInteger& other) {
-        sign == other.sign ? absolute += other.absolute : (absolute < other.absolute ? sign = !sign, absolute = other.absolute - absolute : absolute -= other.absolute), sign = sign && bool(absolute);
-        return *this;
+    constexpr FixedSignedInteger& operator--() {
+        return *this -= FixedSignedInteger(1);
     }
 
-    SignedInteger operator+(const SignedInteger& other) const {
-        return SignedInteger(*this) += other;
+    constexpr FixedSignedInteger operator--(int) {
+        FixedSignedInteger result = *this;
+        return --*this, result;
     }
 
-    SignedInteger& operator-=(const SignedInteger& other) {
-        sign != other.sign ? absolute += other.absolute : (absolute < other.absolute ? sign = !sign, absolute = other.absolute - absolute : absolute -= other.absolute), sign = sign && bool(absolute);
-        return *this;
+    friend constexpr FixedSignedInteger operator*(const FixedSignedInteger& first, const FixedSignedInteger& second) {
+        return FixedSignedInteger(first.absolute * second.absolute, first.sign != second.sign);
     }
 
-    SignedInteger operator-(const SignedInteger& other) const {
-        return SignedInteger(*this) -= other;
+    constexpr FixedSignedInteger& operator*=(const FixedSignedInteger& other) {
+        return *this = *this * other;
     }
 
-    SignedInteger& operator*=(const SignedInteger& other) {
-        absolute *= other.absolute, sign = (sign ^ other.sign) && bool(absolute);
-        return *this;
+    constexpr FixedSignedInteger& square() {
+        return absolute.square(), sign = false, *this;
     }
 
-    SignedInteger operator*(const SignedInteger& other) const {
-        return SignedInteger(*this) *= other;
+    friend constexpr FixedSignedInteger operator/(const FixedSignedInteger& first, const FixedSignedInteger& second) {
+        return FixedSignedInteger(first.absolute / second.absolute, first.sign != second.sign);
     }
 
-    SignedInteger& operator/=(const SignedInteger& other) {
-        VALIDITY_CHECK(bool(other), std::invalid_argument, "SignedInteger division error: divisor is zero.")
-        absolute /= other.absolute, sign ^= other.sign, sign = sign && bool(absolute);
-        return *this;
+    constexpr FixedSignedInteger& operator/=(const FixedSignedInteger& other) {
+        return *this = *this / other;
     }
 
-    SignedInteger operator/(const SignedInteger& other) const {
-        return SignedInteger(*this) /= other;
+    friend constexpr FixedSignedInteger operator%(const FixedSignedInteger& first, const FixedSignedInteger& second) {
+        return FixedSignedInteger(first.absolute % second.absolute, first.sign);
     }
 
-    SignedInteger& operator%=(const SignedInteger& other) {
-        VALIDITY_CHECK(bool(other), std::invalid_argument, "SignedInteger modulus error: modulus is zero.")
-        *this -= (*this / other) * other;
-        return *this;
+    constexpr FixedSignedInteger& operator%=(const FixedSignedInteger& other) {
+        return *this = *this % other;
     }
 
-    SignedInteger operator%(const SignedInteger& other) const {
-        return SignedInteger(*this) %= other;
+    friend constexpr void divmod(const FixedSignedInteger& dividend, const FixedSignedInteger& divisor, FixedSignedInteger& quotient, FixedSignedInteger& remainder) {
+        FixedUnsignedInteger<Limbs> quotientAbsolute, remainderAbsolute;
+        divmod(dividend.absolute, divisor.absolute, quotientAbsolute, remainderAbsolute);
+        quotient = FixedSignedInteger(quotientAbsolute, dividend.sign != divisor.sign), remainder = FixedSignedInteger(remainderAbsolute, dividend.sign);
     }
 };
 
-inline SignedInteger operator""_SI(const char* literal, std::size_t) {
-    return SignedInteger(literal);
-}
-
-inline UnsignedInteger::UnsignedInteger(const SignedInteger& other) : UnsignedInteger(other.absolute) {
-    VALIDITY_CHECK(!other.sign, std::invalid_argument, "UnsignedInteger constructor error: the provided SignedInteger is negative. UnsignedInteger can only represent non-negative integers.")
-}
-
-inline UnsignedInteger& UnsignedInteger::operator=(const SignedInteger& other) {
-    VALIDITY_CHECK(!other.sign, std::invalid_argument, "UnsignedInteger operator= error: the provided SignedInteger is negative. UnsignedInteger can only represent non-negative integers.")
-    return *this = other.absolute;
-}
-
 #undef VALIDITY_CHECK
 #undef __CONSTEXPR
 #endif
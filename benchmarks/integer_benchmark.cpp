@@ -0,0 +1,186 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include "../Integer.h"
+
+// Google Benchmark suite for UnsignedInteger.
+// Sizes are given in limbs (8 decimal digits each) and sweep from 1 limb to
+// INTEGER_BENCHMARK_MAX_LIMBS (default: INTEGER_TRANSFORM_LIMIT).
+// Families:
+//   Parse/*, Print/*            construct from and convert to decimal strings
+//   Add, Subtract, Multiply, Square, Divide, Modulo   balanced operands (division: 2n / n limbs)
+//   MultiplyUnbalanced          n limbs times n / ratio limbs
+//   MultiplyCrossover, SquareCrossover   dense sweep up to INTEGER_BENCHMARK_CROSSOVER_LIMBS (default 128),
+//                               covering the schoolbook/transform crossovers (MultiplyThreshold = 16 per operand,
+//                               MultiplyLengthThreshold = 80 combined, SquareThreshold = 48)
+//   Copy                        copy construction alone; Square times a copy plus the in-place square(),
+//                               like Multiply allocating one fresh result, so subtract Copy for the bare square
+// Run through the run_benchmarks target (or pass --benchmark_out=<file> --benchmark_out_format=json)
+// to record JSON for regression tracking.
+
+#ifndef INTEGER_BENCHMARK_MAX_LIMBS
+#define INTEGER_BENCHMARK_MAX_LIMBS INTEGER_TRANSFORM_LIMIT
+#endif
+
+#ifndef INTEGER_BENCHMARK_CROSSOVER_LIMBS
+#define INTEGER_BENCHMARK_CROSSOVER_LIMBS 128
+#endif
+
+namespace {
+
+constexpr std::int64_t MaxLimbs = INTEGER_BENCHMARK_MAX_LIMBS;
+constexpr std::int64_t CrossoverLimbs = INTEGER_BENCHMARK_CROSSOVER_LIMBS;
+constexpr std::int64_t Multiplier = 8;
+
+std::string randomDigits(std::int64_t limbs, std::uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::string result(std::size_t(limbs) << 3, '0');
+    result[0] = char('1' + digit(generator) % 9);
+    for (std::size_t i = 1; i < result.size(); ++i)
+        result[i] = char('0' + digit(generator));
+    return result;
+}
+
+UnsignedInteger randomInteger(std::int64_t limbs, std::uint32_t seed) {
+    return UnsignedInteger(randomDigits(limbs, seed));
+}
+
+void finish(benchmark::State& state, std::int64_t limbs) {
+    state.SetComplexityN(limbs);
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * limbs * std::int64_t(sizeof(std::uint32_t)));
+    state.counters["limbs"] = double(limbs);
+}
+
+void ParseString(benchmark::State& state) {
+    const std::string text = randomDigits(state.range(0), 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(UnsignedInteger(text));
+    finish(state, state.range(0));
+}
+
+void ParseCString(benchmark::State& state) {
+    const std::string text = randomDigits(state.range(0), 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(UnsignedInteger(text.c_str()));
+    finish(state, state.range(0));
+}
+
+void PrintString(benchmark::State& state) {
+    const UnsignedInteger value = randomInteger(state.range(0), 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::string(value));
+    finish(state, state.range(0));
+}
+
+void PrintCString(benchmark::State& state) {
+    const UnsignedInteger value = randomInteger(state.range(0), 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(static_cast<const char*>(value));
+    finish(state, state.range(0));
+}
+
+void Add(benchmark::State& state) {
+    const UnsignedInteger first = randomInteger(state.range(0), 1), second = randomInteger(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(first + second);
+    finish(state, state.range(0));
+}
+
+void Subtract(benchmark::State& state) {
+    const UnsignedInteger first = randomInteger(state.range(0), 1) + randomInteger(state.range(0), 2), second = randomInteger(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(first - second);
+    finish(state, state.range(0));
+}
+
+void Multiply(benchmark::State& state) {
+    const UnsignedInteger first = randomInteger(state.range(0), 1), second = randomInteger(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(first * second);
+    finish(state, state.range(0));
+}
+
+void MultiplyUnbalanced(benchmark::State& state) {
+    const std::int64_t smallLimbs = std::max<std::int64_t>(state.range(0) / state.range(1), 1);
+    const UnsignedInteger first = randomInteger(state.range(0), 1), second = randomInteger(smallLimbs, 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(first * second);
+    finish(state, state.range(0));
+}
+
+void Square(benchmark::State& state) {
+    const UnsignedInteger value = randomInteger(state.range(0), 1);
+    for (auto _ : state) {
+        UnsignedInteger result = value;
+        benchmark::DoNotOptimize(result.square());
+    }
+    finish(state, state.range(0));
+}
+
+void Copy(benchmark::State& state) {
+    const UnsignedInteger value = randomInteger(state.range(0), 1);
+    for (auto _ : state) {
+        UnsignedInteger result = value;
+        benchmark::DoNotOptimize(result);
+    }
+    finish(state, state.range(0));
+}
+
+void Divide(benchmark::State& state) {
+    const UnsignedInteger dividend = randomInteger(state.range(0) << 1, 1), divisor = randomInteger(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(dividend / divisor);
+    finish(state, state.range(0));
+}
+
+void Modulo(benchmark::State& state) {
+    const UnsignedInteger dividend = randomInteger(state.range(0) << 1, 1), divisor = randomInteger(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(dividend % divisor);
+    finish(state, state.range(0));
+}
+
+void limbSweep(benchmark::internal::Benchmark* benchmark, std::int64_t maxLimbs) {
+    benchmark->RangeMultiplier(Multiplier)->Range(1, maxLimbs)->Complexity();
+}
+
+void fullSweep(benchmark::internal::Benchmark* benchmark) {
+    limbSweep(benchmark, MaxLimbs);
+}
+
+void divisionSweep(benchmark::internal::Benchmark* benchmark) {
+    limbSweep(benchmark, std::max<std::int64_t>(MaxLimbs >> 1, 1));
+}
+
+void unbalancedSweep(benchmark::internal::Benchmark* benchmark) {
+    for (std::int64_t ratio : {4, 64})
+        for (std::int64_t limbs = ratio; limbs <= MaxLimbs; limbs *= Multiplier)
+            benchmark->Args({limbs, ratio});
+    benchmark->ArgNames({"limbs", "ratio"});
+}
+
+void crossoverSweep(benchmark::internal::Benchmark* benchmark) {
+    benchmark->DenseRange(8, CrossoverLimbs, 8);
+}
+
+}
+
+BENCHMARK(ParseString)->Name("Parse/string")->Apply(fullSweep);
+BENCHMARK(ParseCString)->Name("Parse/cstring")->Apply(fullSweep);
+BENCHMARK(PrintString)->Name("Print/string")->Apply(fullSweep);
+BENCHMARK(PrintCString)->Name("Print/cstring")->Apply(fullSweep);
+BENCHMARK(Add)->Apply(fullSweep);
+BENCHMARK(Subtract)->Apply(fullSweep);
+BENCHMARK(Multiply)->Apply(fullSweep);
+BENCHMARK(MultiplyUnbalanced)->Apply(unbalancedSweep);
+BENCHMARK(Square)->Apply(fullSweep);
+BENCHMARK(Copy)->Apply(fullSweep);
+BENCHMARK(Divide)->Apply(divisionSweep);
+BENCHMARK(Modulo)->Apply(divisionSweep);
+BENCHMARK(Multiply)->Name("MultiplyCrossover")->Apply(crossoverSweep);
+BENCHMARK(Square)->Name("SquareCrossover")->Apply(crossoverSweep);
+
+BENCHMARK_MAIN();
@@ -2,24 +2,123 @@
 #include <string>
 #include <sstream>
 #include <cctype>
+#include <cstring>
+#include <iomanip>
+#include <list>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 #include "../Integer.h"
 
 // Simple CLI to exercise UnsignedInteger and SignedInteger
 // Protocol (per line, whitespace separated):
-//   <type> <op> <a> [b]
+//   <type> <op> <a> [b] [c]
 // where:
 //   <type>: U | S   (UnsignedInteger or SignedInteger)
-//   <op>: add sub mul div mod cmp to_str to_u64 to_s64 to_double
+//   <op>: add sub mul div mod cmp sqr pmul to_str to_u64 to_s64 to_double
+//         (pmul: multiplies a by b twice through one PreparedMultiplier, U only)
+//         bred mulmod powmod (U only, through a BarrettContext: a mod b, a*b mod c, a^b mod c)
+//         pow (a^b), spowmod (S only, free powmod: a^b mod c)
+//         to_radix (a printed in radix b), from_radix (a parsed in radix b, printed in decimal)
+//         divmod (quotient and remainder, printed as "q r"), divmod_into (the same, written back into a and b and into separate objects that already hold digits)
+//         adds subs muls divs mods (a op b with b a native integer), rsubs rdivs rmods (b op a with b a native integer)
+//         arena (U only: a*b + a%b computed inside an IntegerArena scope, then moved out after the arena is released)
+//         to_bytes (U only, big-endian bytes of a as hex), from_bytes (U only, a is a hex byte string)
+//         mul_parallel (U only: a*b and a*a inside an IntegerThreadPool scope, printed as "p s")
+//         mul_threads (U only: a*b on several threads sharing the twiddle tables, releasing scratch in between; prints a*b)
+//         mul_batch (U only: multiplyBatch over pairs built from a and b, serially, on an IntegerThreadPool and in place over the second operands; prints "a*b <all products match>")
+//         serialize (U: a round-tripped through serialize/deserialize, then an UnsignedIntegerView over the serialized a in "v+b v*b cmp(v,b)"; S: a round-tripped only)
+//         profile (U only, built with INTEGER_INSTRUMENTATION: a*b and a/b on fresh thread counters; prints "a*b a/b <joined thread merged into total()> [<name> <calls> <limbs>]... allocations <count> <bytes>")
+//         fixed (a and b in FixedUnsignedInteger<128> / FixedSignedInteger<128>: prints "a+b a*b a/b a%b a^2 <a*b matches the dynamic type>")
+//         sqrtrem (U only: "s r" with s = floor(sqrt(a)), r = a - s^2, then <sqrt(a) == s>), root (U only: floor of the b-th root of a), is_square (U only)
+//         gcd (gcdext(a, b) and lcm(a, b): prints "g x y l <gcd(a, b) == g>" with g = x*a + y*b), modinv (inverse of a modulo b, EXC when none exists)
+//         factorial (U only: a!), binomial (U only: a choose b), product (U only: product of the integers in [a, b], serially from a vector and on an IntegerThreadPool from a std::list; prints "p <both match>")
+//         moves (a+b and a-b, then <every rvalue-operand form of +, -, and of +, -, *, / by a native integer matches>; U needs a >= b)
+//         decimal (a*10^b, a/10^b and a%10^b through shiftLeftDecimal/shiftRightDecimal/modPow10, then digitCount(a) and digitAt(a, b))
+//         stream (a read with operator>> and written with operator<< under setw/setfill, and through toChars; prints "value <all forms match>")
+//         fma (a*b + c), addmul submul (a +/-= b*c in place), addmul_alias (a += a*b in place), fmulmod (free mulmod: a*b mod c)
 //   <a>, <b>: base-10 integer strings (for S may start with '-')
 // Output:
 //   On success:  "OK <result>" (result is decimal string or scalar)
 //   On exception: "EXC <what>"
 
+template <typename Fixed, typename Integer>
+static std::string fixedArithmetic(const std::string &a, const std::string &b) {
+    const Fixed x(a), y(b);
+    Fixed quotient, remainder, square = x;
+    divmod(x, y, quotient, remainder), square.square();
+    std::ostringstream out;
+    out << x + y << ' ' << x * y << ' ' << quotient << ' ' << remainder << ' ' << square << ' ' << (Integer(x * y) == Integer(a.c_str()) * Integer(b.c_str()) && quotient == x / y && remainder == x % y);
+    return out.str();
+}
+
+template <typename Integer>
+static std::string movesReport(const std::string &a, const std::string &b) {
+    const Integer x(a.c_str()), y(b.c_str()), sum = x + y, difference = x - y;
+    bool match = Integer(x) + y == sum && x + Integer(y) == sum && Integer(x) + Integer(y) == sum && Integer(y) + Integer(x) == sum;
+    match = match && Integer(x) - y == difference && x - Integer(y) == difference && Integer(x) - Integer(y) == difference && Integer(sum) - y - y == difference;
+    match = match && Integer(x) + 7 == x + 7 && Integer(sum) + 7 - 7 == sum && Integer(x) * 9 == x * 9 && Integer(x) / 3 == x / 3 && (Integer(x) + y) * 2 - x - x == y + y;
+    std::ostringstream out;
+    out << sum << ' ' << difference << ' ' << match;
+    return out.str();
+}
+
+template <typename Integer>
+static std::string decimalReport(const std::string &a, const std::string &b) {
+    const Integer x(a.c_str());
+    const std::uint32_t shift = std::uint32_t(std::stoul(b));
+    Integer scaled = x, truncated = x, reduced = x;
+    scaled.shiftLeftDecimal(shift), truncated.shiftRightDecimal(shift), reduced.modPow10(shift);
+    std::ostringstream out;
+    out << scaled << ' ' << truncated << ' ' << reduced << ' ' << x.digitCount() << ' ' << x.digitAt(shift);
+    return out.str();
+}
+
+template <typename Integer>
+static std::string gcdReport(const std::string &a, const std::string &b) {
+    const Integer x(a.c_str()), y(b.c_str());
+    const auto result = gcdext(x, y);
+    std::ostringstream out;
+    out << std::get<0>(result) << ' ' << std::get<1>(result) << ' ' << std::get<2>(result) << ' ' << lcm(x, y) << ' ' << (gcd(x, y) == std::get<0>(result));
+    return out.str();
+}
+
 static inline void trim(std::string &s) {
     size_t p = 0; while (p < s.size() && std::isspace(static_cast<unsigned char>(s[p]))) ++p; s.erase(0, p);
     while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back()))) s.pop_back();
 }
 
+template <typename Integer>
+static std::string streamRoundTrip(const std::string &text) {
+    std::istringstream in(" \t" + text + " 7");
+    Integer value, tail;
+    in >> value >> tail;
+    const std::string expected = static_cast<std::string>(value);
+    std::ostringstream padded, left;
+    padded << std::setw(int(expected.size() + 3)) << std::setfill('#') << value;
+    left << std::left << std::setw(int(expected.size() + 2)) << std::setfill('*') << value << '|';
+    std::vector<char> buffer(value.decimalLength());
+    char *end = value.toChars(buffer.data(), buffer.data() + buffer.size());
+    const bool match = in.eof() && !in.fail() && tail == Integer(7) && end == buffer.data() + buffer.size() && std::string(buffer.data(), end) == expected && padded.str() == "###" + expected && left.str() == expected + "**|" && !value.toChars(buffer.data(), buffer.data() + buffer.size() - 1);
+    return expected + (match ? " 1" : " 0");
+}
+
+static inline bool isScalarOp(const std::string &op) {
+    return op == "adds" || op == "subs" || op == "muls" || op == "divs" || op == "mods" || op == "rsubs" || op == "rdivs" || op == "rmods";
+}
+
+template <typename Integer, typename Scalar>
+static Integer scalarOp(const std::string &op, Integer a, Scalar b) {
+    if (op == "adds") return a += b;
+    if (op == "subs") return a -= b;
+    if (op == "muls") return a * b;
+    if (op == "divs") return a /= b;
+    if (op == "mods") return a % b;
+    if (op == "rsubs") return b - a;
+    if (op == "rdivs") return b / a;
+    return b % a;
+}
+
 int main() {
     std::ios::sync_with_stdio(false);
     std::cin.tie(nullptr);
@@ -29,15 +128,18 @@ int main() {
         trim(line);
         if (line.empty()) continue;
         std::istringstream iss(line);
-        std::string type, op, a, b;
+        std::string type, op, a, b, c;
         iss >> type >> op >> a;
         if (type.empty() || op.empty() || a.empty()) {
             std::cout << "EXC invalid input" << '\n';
             continue;
         }
-        if (op == "add" || op == "sub" || op == "mul" || op == "div" || op == "mod" || op == "cmp") {
+        if (op == "add" || op == "sub" || op == "mul" || op == "div" || op == "mod" || op == "cmp" || op == "pmul" || op == "pow" || op == "to_radix" || op == "from_radix" || op == "divmod" || op == "divmod_into" || isScalarOp(op) || op == "arena" || op == "addmul_alias" || op == "mul_parallel" || op == "mul_threads" || op == "mul_batch" || op == "profile" || op == "fixed" || op == "root" || op == "gcd" || op == "modinv" || op == "binomial" || op == "product" || op == "moves" || op == "decimal" || (op == "serialize" && type == "U")) {
             if (!(iss >> b)) { std::cout << "EXC missing operand" << '\n'; continue; }
         }
+        if (op == "bred" || op == "mulmod" || op == "powmod" || op == "spowmod" || op == "fma" || op == "addmul" || op == "submul" || op == "fmulmod") {
+            if (!(iss >> b) || (op != "bred" && !(iss >> c))) { std::cout << "EXC missing operand" << '\n'; continue; }
+        }
         try {
             if (type == "U") {
                 if (op == "to_str") {
@@ -52,6 +154,18 @@ int main() {
                     double v = static_cast<double>(ua);
                     std::ostringstream os; os.setf(std::ios::fixed); os.precision(0); os << v; // no frac
                     std::cout << "OK " << os.str() << '\n';
+                } else if (op == "sqr") {
+                    UnsignedInteger ua(a.c_str());
+                    ua.square();
+                    std::cout << "OK " << ua << '\n';
+                } else if (op == "sqrtrem") {
+                    UnsignedInteger ua(a.c_str());
+                    std::pair<UnsignedInteger, UnsignedInteger> result = sqrtrem(ua);
+                    std::cout << "OK " << result.first << ' ' << result.second << ' ' << (sqrt(ua) == result.first) << '\n';
+                } else if (op == "root") {
+                    std::cout << "OK " << nthRoot(UnsignedInteger(a.c_str()), std::uint32_t(std::stoul(b))) << '\n';
+                } else if (op == "is_square") {
+                    std::cout << "OK " << isPerfectSquare(UnsignedInteger(a.c_str())) << '\n';
                 } else if (op == "add" || op == "sub" || op == "mul" || op == "div" || op == "mod") {
                     UnsignedInteger ua(a.c_str());
                     UnsignedInteger ub(b.c_str());
@@ -71,6 +185,169 @@ int main() {
                         auto r = ua % ub; // may throw if ub == 0
                         std::cout << "OK " << r << '\n';
                     }
+                } else if (op == "pmul") {
+                    UnsignedInteger ua(a.c_str());
+                    PreparedMultiplier prepared(UnsignedInteger(b.c_str()));
+                    ua.multiply(prepared).multiply(prepared);
+                    std::cout << "OK " << ua << '\n';
+                } else if (op == "pow") {
+                    std::cout << "OK " << pow(UnsignedInteger(a.c_str()), UnsignedInteger(b.c_str())) << '\n';
+                } else if (op == "to_radix") {
+                    std::string r = UnsignedInteger(a.c_str()).toString(std::stoul(b));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "from_radix") {
+                    UnsignedInteger r = UnsignedInteger::fromString(a, std::stoul(b));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "to_bytes") {
+                    static const char hex[] = "0123456789abcdef";
+                    std::string r;
+                    for (std::uint8_t byte : UnsignedInteger(a.c_str()).toBytes()) r += hex[byte >> 4], r += hex[byte & 15];
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "from_bytes") {
+                    std::vector<std::uint8_t> bytes;
+                    for (size_t i = 0; i + 1 < a.size(); i += 2) bytes.push_back(static_cast<std::uint8_t>(std::stoul(a.substr(i, 2), nullptr, 16)));
+                    std::cout << "OK " << UnsignedInteger::fromBytes(bytes) << '\n';
+                } else if (op == "bred") {
+                    BarrettContext context(UnsignedInteger(b.c_str()));
+                    std::cout << "OK " << context.reduce(UnsignedInteger(a.c_str())) << '\n';
+                } else if (op == "mulmod" || op == "powmod") {
+                    BarrettContext context(UnsignedInteger(c.c_str()));
+                    UnsignedInteger ua(a.c_str());
+                    UnsignedInteger ub(b.c_str());
+                    std::cout << "OK " << (op == "mulmod" ? context.mulmod(ua, ub) : context.powmod(ua, ub)) << '\n';
+                } else if (op == "arena") {
+                    UnsignedInteger r;
+                    {
+                        IntegerArena arena(64);
+                        IntegerMemoryScope scope(&arena);
+                        UnsignedInteger ua(a.c_str()), ub(b.c_str());
+                        UnsignedInteger t = ua * ub;
+                        for (int i = 0; i < 8; ++i) t += ua % ub, t -= ua % ub;
+                        t += ua % ub;
+                        (void)t.toString(16);
+                        r = std::move(t);
+                    }
+                    std::cout << "OK " << r << ' ' << (r.toString(16) == UnsignedInteger::fromString(r.toString(16), 16).toString(16)) << '\n';
+                } else if (op == "mul_parallel") {
+                    UnsignedInteger ua(a.c_str()), ub(b.c_str()), p, s;
+                    {
+                        IntegerThreadPool pool(3);
+                        IntegerExecutorScope scope(&pool);
+                        p = ua * ub, s = ua * ua;
+                    }
+                    std::cout << "OK " << p << ' ' << s << '\n';
+                } else if (op == "stream") {
+                    std::cout << "OK " << streamRoundTrip<UnsignedInteger>(a) << '\n';
+                } else if (op == "fixed") {
+                    std::cout << "OK " << fixedArithmetic<FixedUnsignedInteger<128>, UnsignedInteger>(a, b) << '\n';
+                } else if (op == "gcd") {
+                    std::cout << "OK " << gcdReport<UnsignedInteger>(a, b) << '\n';
+                } else if (op == "moves") {
+                    std::cout << "OK " << movesReport<UnsignedInteger>(a, b) << '\n';
+                } else if (op == "decimal") {
+                    std::cout << "OK " << decimalReport<UnsignedInteger>(a, b) << '\n';
+                } else if (op == "factorial") {
+                    std::cout << "OK " << UnsignedInteger::factorial(std::uint32_t(std::stoul(a))) << '\n';
+                } else if (op == "binomial") {
+                    std::cout << "OK " << UnsignedInteger::binomial(std::uint32_t(std::stoul(a)), std::uint32_t(std::stoul(b))) << '\n';
+                } else if (op == "product") {
+                    std::vector<UnsignedInteger> values;
+                    std::list<unsigned long> words;
+                    for (unsigned long i = std::stoul(a), last = std::stoul(b); i <= last; ++i) values.emplace_back(i), words.push_back(i);
+                    const UnsignedInteger serial = UnsignedInteger::product(values);
+                    UnsignedInteger parallel;
+                    {
+                        IntegerThreadPool pool(3);
+                        IntegerExecutorScope scope(&pool);
+                        parallel = UnsignedInteger::product(words.begin(), words.end());
+                    }
+                    std::cout << "OK " << serial << ' ' << (serial == parallel) << '\n';
+                } else if (op == "modinv") {
+                    const UnsignedInteger inverse = modinv(UnsignedInteger(a.c_str()), UnsignedInteger(b.c_str()));
+                    std::cout << "OK " << inverse << '\n';
+#ifdef INTEGER_INSTRUMENTATION
+                } else if (op == "profile") {
+                    const UnsignedInteger ua(a.c_str()), ub(b.c_str());
+                    IntegerStatistics::resetThread();
+                    const UnsignedInteger p = ua * ub, q = ua / ub;
+                    const IntegerStatistics local = IntegerStatistics::thread(), before = IntegerStatistics::total();
+                    IntegerStatistics worker{};
+                    std::thread([&] { (void)(ua * ub); worker = IntegerStatistics::thread(); }).join();
+                    const IntegerStatistics after = IntegerStatistics::total();
+                    bool merged = true;
+                    for (std::uint32_t i = 0; i != std::uint32_t(IntegerAlgorithm::Count); ++i)
+                        merged = merged && after.algorithms[i].calls - before.algorithms[i].calls == worker.algorithms[i].calls && after.algorithms[i].limbs - before.algorithms[i].limbs == worker.algorithms[i].limbs;
+                    std::cout << "OK " << p << ' ' << q << ' ' << merged;
+                    local.forEach([](const char *name, const IntegerCounter &counter) {
+                        if (counter.calls)
+                            std::cout << ' ' << name << ' ' << counter.calls << ' ' << counter.limbs;
+                    });
+                    std::cout << " allocations " << local.allocations << ' ' << local.allocatedBytes << '\n';
+#endif
+                } else if (op == "serialize") {
+                    const UnsignedInteger ua(a.c_str()), ub(b.c_str());
+                    const std::vector<std::uint8_t> bytes = ua.serialize();
+                    std::vector<std::uint32_t> mapped((bytes.size() + 3) / 4);
+                    std::memcpy(mapped.data(), bytes.data(), bytes.size());
+                    const UnsignedIntegerView view = UnsignedIntegerView::fromSerialized(mapped.data(), bytes.size());
+                    int sgn = (view < ub) ? -1 : (view == ub ? 0 : 1);
+                    std::cout << "OK " << UnsignedInteger::deserialize(bytes) << ' ' << view + ub << ' ' << view * ub << ' ' << sgn << '\n';
+                } else if (op == "mul_batch") {
+                    const UnsignedInteger ua(a.c_str()), ub(b.c_str());
+                    std::vector<UnsignedInteger> first, second;
+                    for (std::uint32_t i = 0; i != 24; ++i)
+                        first.push_back(i % 3 ? ua + UnsignedInteger(i) : ua), second.push_back(i % 4 ? ub : ua + ub);
+                    std::vector<UnsignedInteger> serial = UnsignedInteger::multiplyBatch(first, second), pooled;
+                    {
+                        IntegerThreadPool pool(3);
+                        IntegerExecutorScope scope(&pool);
+                        pooled = UnsignedInteger::multiplyBatch(first, second);
+                    }
+                    bool match = serial.size() == first.size() && pooled.size() == first.size();
+                    for (std::size_t i = 0; match && i != first.size(); ++i)
+                        match = serial[i] == first[i] * second[i] && pooled[i] == serial[i];
+                    std::vector<UnsignedInteger> inPlace = second;
+                    UnsignedInteger::multiplyBatch(first.data(), inPlace.data(), inPlace.data(), std::uint32_t(inPlace.size()));
+                    match = match && inPlace == serial;
+                    std::cout << "OK " << serial[1] << ' ' << match << '\n';
+                } else if (op == "mul_threads") {
+                    const UnsignedInteger ua(a.c_str()), ub(b.c_str());
+                    UnsignedInteger results[4];
+                    std::vector<std::thread> threads;
+                    for (int i = 1; i != 4; ++i)
+                        threads.emplace_back([&, i] { UnsignedInteger::releaseScratch(), results[i] = ua * ua, UnsignedInteger::releaseScratch(), results[i] = ua * ub; });
+                    results[0] = ua * ub, UnsignedInteger::releaseScratch(), results[0] = ua * ub;
+                    for (std::thread &thread : threads) thread.join();
+                    if (!(results[0] == results[1] && results[0] == results[2] && results[0] == results[3])) throw std::runtime_error("threaded products differ");
+                    std::cout << "OK " << results[0] << '\n';
+                } else if (isScalarOp(op)) {
+                    UnsignedInteger r = scalarOp(op, UnsignedInteger(a.c_str()), std::stoull(b));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "divmod") {
+                    auto r = divmod(UnsignedInteger(a.c_str()), UnsignedInteger(b.c_str()));
+                    std::cout << "OK " << r.first << ' ' << r.second << '\n';
+                } else if (op == "fma") {
+                    UnsignedInteger r = fma(UnsignedInteger(a.c_str()), UnsignedInteger(b.c_str()), UnsignedInteger(c.c_str()));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "addmul" || op == "submul") {
+                    UnsignedInteger ua(a.c_str());
+                    op == "addmul" ? addmul(ua, UnsignedInteger(b.c_str()), UnsignedInteger(c.c_str())) : submul(ua, UnsignedInteger(b.c_str()), UnsignedInteger(c.c_str()));
+                    std::cout << "OK " << ua << '\n';
+                } else if (op == "addmul_alias") {
+                    UnsignedInteger ua(a.c_str());
+                    addmul(ua, ua, UnsignedInteger(b.c_str()));
+                    std::cout << "OK " << ua << '\n';
+                } else if (op == "fmulmod") {
+                    UnsignedInteger r = mulmod(UnsignedInteger(a.c_str()), UnsignedInteger(b.c_str()), UnsignedInteger(c.c_str()));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "divmod_into") {
+                    UnsignedInteger ua(a.c_str());
+                    UnsignedInteger ub(b.c_str());
+                    UnsignedInteger quotient(ub), remainder(ua);
+                    divmod(UnsignedInteger(ua), UnsignedInteger(ub), quotient, remainder);
+                    divmod(ua, ub, ua, ub);
+                    if (!(quotient == ua && remainder == ub)) throw std::runtime_error("divmod into separate objects differs");
+                    std::cout << "OK " << ua << ' ' << ub << '\n';
                 } else if (op == "cmp") {
                     UnsignedInteger ua(a.c_str());
                     UnsignedInteger ub(b.c_str());
@@ -80,7 +357,22 @@ int main() {
                     std::cout << "EXC unknown op" << '\n';
                 }
             } else if (type == "S") {
-                if (op == "to_str") {
+                if (op == "stream") {
+                    std::cout << "OK " << streamRoundTrip<SignedInteger>(a) << '\n';
+                } else if (op == "fixed") {
+                    std::cout << "OK " << fixedArithmetic<FixedSignedInteger<128>, SignedInteger>(a, b) << '\n';
+                } else if (op == "gcd") {
+                    std::cout << "OK " << gcdReport<SignedInteger>(a, b) << '\n';
+                } else if (op == "moves") {
+                    std::cout << "OK " << movesReport<SignedInteger>(a, b) << '\n';
+                } else if (op == "decimal") {
+                    std::cout << "OK " << decimalReport<SignedInteger>(a, b) << '\n';
+                } else if (op == "modinv") {
+                    const SignedInteger inverse = modinv(SignedInteger(a.c_str()), SignedInteger(b.c_str()));
+                    std::cout << "OK " << inverse << '\n';
+                } else if (op == "serialize") {
+                    std::cout << "OK " << SignedInteger::deserialize(SignedInteger(a.c_str()).serialize()) << '\n';
+                } else if (op == "to_str") {
                     SignedInteger sa(a.c_str());
                     std::cout << "OK " << sa << '\n';
                 } else if (op == "to_s64") {
@@ -96,6 +388,20 @@ int main() {
                     double v = static_cast<double>(sa);
                     std::ostringstream os; os.setf(std::ios::fixed); os.precision(0); os << v; // no frac
                     std::cout << "OK " << os.str() << '\n';
+                } else if (op == "sqr") {
+                    SignedInteger sa(a.c_str());
+                    sa.square();
+                    std::cout << "OK " << sa << '\n';
+                } else if (op == "pow") {
+                    std::cout << "OK " << pow(SignedInteger(a.c_str()), UnsignedInteger(b.c_str())) << '\n';
+                } else if (op == "to_radix") {
+                    std::string r = SignedInteger(a.c_str()).toString(std::stoul(b));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "from_radix") {
+                    SignedInteger r = SignedInteger::fromString(a, std::stoul(b));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "spowmod") {
+                    std::cout << "OK " << powmod(SignedInteger(a.c_str()), UnsignedInteger(b.c_str()), UnsignedInteger(c.c_str())) << '\n';
                 } else if (op == "add" || op == "sub" || op == "mul" || op == "div" || op == "mod") {
                     SignedInteger sa(a.c_str());
                     SignedInteger sb(b.c_str());
@@ -115,6 +421,34 @@ int main() {
                         auto r = sa % sb; // may throw if sb == 0
                         std::cout << "OK " << r << '\n';
                     }
+                } else if (isScalarOp(op)) {
+                    SignedInteger r = scalarOp(op, SignedInteger(a.c_str()), std::stoll(b));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "divmod") {
+                    auto r = divmod(SignedInteger(a.c_str()), SignedInteger(b.c_str()));
+                    std::cout << "OK " << r.first << ' ' << r.second << '\n';
+                } else if (op == "fma") {
+                    SignedInteger r = fma(SignedInteger(a.c_str()), SignedInteger(b.c_str()), SignedInteger(c.c_str()));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "addmul" || op == "submul") {
+                    SignedInteger sa(a.c_str());
+                    op == "addmul" ? addmul(sa, SignedInteger(b.c_str()), SignedInteger(c.c_str())) : submul(sa, SignedInteger(b.c_str()), SignedInteger(c.c_str()));
+                    std::cout << "OK " << sa << '\n';
+                } else if (op == "addmul_alias") {
+                    SignedInteger sa(a.c_str());
+                    addmul(sa, sa, SignedInteger(b.c_str()));
+                    std::cout << "OK " << sa << '\n';
+                } else if (op == "fmulmod") {
+                    UnsignedInteger r = mulmod(SignedInteger(a.c_str()), SignedInteger(b.c_str()), UnsignedInteger(c.c_str()));
+                    std::cout << "OK " << r << '\n';
+                } else if (op == "divmod_into") {
+                    SignedInteger sa(a.c_str());
+                    SignedInteger sb(b.c_str());
+                    SignedInteger quotient(sb), remainder(sa);
+                    divmod(SignedInteger(sa), SignedInteger(sb), quotient, remainder);
+                    divmod(sa, sb, sa, sb);
+                    if (!(quotient == sa && remainder == sb)) throw std::runtime_error("divmod into separate objects differs");
+                    std::cout << "OK " << sa << ' ' << sb << '\n';
                 } else if (op == "cmp") {
                     SignedInteger sa(a.c_str());
                     SignedInteger sb(b.c_str());
@@ -1,14 +1,22 @@
 #!/usr/bin/env python3
+import math
 import os
 import sys
+import platform
 import subprocess
 import random
 import string
 from pathlib import Path
 
+if hasattr(sys, "set_int_max_str_digits"):
+    sys.set_int_max_str_digits(0)
+
 ROOT = Path(__file__).resolve().parents[1]
 CLI_SIMD = ROOT / "tests" / "integer_cli"
 CLI_FALLBACK = ROOT / "tests" / "integer_cli_fallback"
+CLI_MODULAR = ROOT / "tests" / "integer_cli_modular"
+CLI_MODULAR_FALLBACK = ROOT / "tests" / "integer_cli_modular_fallback"
+CLI_AVX2 = ROOT / "tests" / "integer_cli_avx2"
 SRC = ROOT / "tests" / "integer_cli.cpp"
 HDR = ROOT / "Integer.h"
 
@@ -34,9 +42,24 @@ def build_target(out_path: Path, extra_flags=None):
     subprocess.check_call(cmd)
 
 
+X86_HOST = platform.machine().lower() in ("x86_64", "amd64")
+HOST_FLAGS = ["-march=native"] if X86_HOST else []
+# On AVX-512 hosts the native build uses the 512-bit butterflies; this build keeps the 128-bit AVX2 kernels covered.
+AVX2_FLAGS = ["-mavx2", "-mfma", "-DINTEGER_DISABLE_AVX512"]
+FALLBACK_FLAGS = ["-U__AVX2__", "-U__ARM_NEON__"]
+# Lowering the FFT limit routes every transform-sized product through the NTT engine.
+MODULAR_FLAGS = ["-DINTEGER_TRANSFORM_LIMIT=64"]
+# The modular build also carries the instrumentation hooks, so every tier runs with them compiled in.
+INSTRUMENTATION_FLAGS = ["-DINTEGER_INSTRUMENTATION"]
+
+
 def build_all():
-    build_target(CLI_SIMD)
-    build_target(CLI_FALLBACK, extra_flags=["-U__AVX2__", "-U__ARM_NEON__"])
+    build_target(CLI_SIMD, extra_flags=HOST_FLAGS)
+    build_target(CLI_FALLBACK, extra_flags=FALLBACK_FLAGS)
+    build_target(CLI_MODULAR, extra_flags=HOST_FLAGS + MODULAR_FLAGS + INSTRUMENTATION_FLAGS)
+    build_target(CLI_MODULAR_FALLBACK, extra_flags=FALLBACK_FLAGS + MODULAR_FLAGS)
+    if X86_HOST:
+        build_target(CLI_AVX2, extra_flags=AVX2_FLAGS)
 
 
 def run_cli(cli_path: Path, lines):
@@ -91,6 +114,8 @@ def test_deterministic(cli_path: Path):
         "S div -100 7",
         "S mod -100 7",
         "S cmp -100 7",
+        "U sqr 12345678901234567890",
+        "S sqr -99999999",
     ]
     lines += [
         "U add 0 0",
@@ -98,7 +123,53 @@ def test_deterministic(cli_path: Path):
         "S add 0 -0",
         "U div 1 1",
         "U mod 1 1",
+        "U pmul 12345678901234567890 98765432109876543210",
+        "U pow 3 0",
+        "U pow 0 0",
+        "U pow 7 123",
+        "S pow -7 123",
+        "S pow -7 124",
+        "S spowmod -7 123 1000000007",
+        "U powmod 5 0 1",
+        "U to_radix 0 2",
+        "U to_radix 255 16",
+        "S to_radix -35 36",
+        "U from_radix 00FF 16",
+        "S from_radix -z 36",
+        "U to_bytes 0",
+        "U from_bytes 000100",
+        "U divmod 1000 7",
+        "S divmod -7 2",
+        "S divmod_into 7 -2",
+        "U fma 99999999 99999999 99999999",
+        "S fma -3 4 5",
+        "S addmul 5 -3 2",
+        "S submul -6 -3 2",
+        "U addmul_alias 99999999 99999999",
+        "S fmulmod -3 4 7",
+    ]
+    arena_a, arena_b = "7" * 3000, "3" * 1500
+    lines += [
+        f"U arena {arena_a} {arena_b}",
+        "U arena 5 3",
     ]
+    all_nines = "9" * 4160
+    lines += [
+        f"U mul {all_nines} {all_nines}",
+        f"U sqr {all_nines}",
+        f"U mul {all_nines} 1{'0' * 4159}",
+    ]
+    # Carry and borrow chains that cross the vector lanes of the add/sub kernels.
+    chain_limbs = (7, 8, 9, 16, 17, 33)
+    for limbs in chain_limbs:
+        lines += [
+            f"U add {'9' * (8 * limbs)} 1",
+            f"U add {'9' * (8 * limbs)} {'9' * (8 * limbs)}",
+            f"U add {'99999999' * (limbs - 1)}99999998 {'0' * 7}1{'0' * (8 * limbs - 8)}",
+            f"U sub 1{'0' * (8 * limbs)} 1",
+            f"U sub 1{'0' * (8 * limbs)} {'9' * (8 * limbs)}",
+            f"U sub {'1' + '0' * 7 * 8 + '5' * (8 * limbs)} {'6' * (8 * limbs)}",
+        ]
     rc, out, err = run_cli(cli_path, lines)
     assert rc == 0, f"CLI exited {rc}, stderr={err}"
     idx = 0
@@ -131,12 +202,52 @@ def test_deterministic(cli_path: Path):
     assert ok() == str(cxx_div_trunc(-100, 7))
     assert ok() == str(cxx_mod(-100, 7))
     assert ok() == str(-1)
+    assert ok() == str(12345678901234567890 ** 2)
+    assert ok() == str(99999999 ** 2)
 
     assert ok() == "0"
     assert ok() == "0"
     assert ok() == "0"
     assert ok() == "1"
     assert ok() == "0"
+    assert ok() == str(12345678901234567890 * 98765432109876543210**2)
+    assert ok() == "1"
+    assert ok() == "1"
+    assert ok() == str(7**123)
+    assert ok() == str((-7) ** 123)
+    assert ok() == str((-7) ** 124)
+    assert ok() == str(pow(-7, 123, 1000000007))
+    assert ok() == "0"
+    assert ok() == "0"
+    assert ok() == "ff"
+    assert ok() == "-z"
+    assert ok() == "255"
+    assert ok() == "-35"
+    assert ok() == "00"
+    assert ok() == "256"
+    assert ok() == "142 6"
+    assert ok() == "-3 -1"
+    assert ok() == "-3 1"
+    assert ok() == str(99999999 * 99999999 + 99999999)
+    assert ok() == "-7"
+    assert ok() == "-1"
+    assert ok() == "0"
+    assert ok() == str(99999999 + 99999999 * 99999999)
+    assert ok() == "2"
+    assert ok() == f"{int(arena_a) * int(arena_b) + int(arena_a) % int(arena_b)} 1"
+    assert ok() == "17 1"
+
+    assert ok() == str(int(all_nines) ** 2)
+    assert ok() == str(int(all_nines) ** 2)
+    assert ok() == str(int(all_nines) * 10 ** 4159)
+    for limbs in chain_limbs:
+        nines = 10 ** (8 * limbs) - 1
+        assert ok() == str(nines + 1)
+        assert ok() == str(2 * nines)
+        assert ok() == str(nines - 1 + 10 ** (8 * limbs - 8))
+        assert ok() == str(nines)
+        assert ok() == "1"
+        assert ok() == str(int("1" + "0" * 56 + "5" * (8 * limbs)) - int("6" * (8 * limbs)))
 
     print(f"[OK] deterministic tests passed on {cli_path.name}")
 
@@ -163,11 +274,11 @@ def test_random(cli_path: Path, seed=0xC0FFEE, cases=2000):
     for _ in range(cases):
         a = rand_bigint_str()
         b = rand_bigint_str()
-        op = random.choice(["add", "sub", "mul", "div", "mod", "cmp"])
+        op = random.choice(["add", "sub", "mul", "div", "mod", "cmp", "sqr", "pmul", "divmod", "divmod_into"])
         if op == "sub":
             if len(a) < len(b) or (len(a) == len(b) and a < b):
                 a, b = b, a
-        if op in ("div", "mod") and b == "0":
+        if op in ("div", "mod", "divmod", "divmod_into") and b == "0":
             b = "1"
         lines.append(f"U {op} {a} {b}")
         refs.append(("U", op, a, b))
@@ -175,8 +286,8 @@ def test_random(cli_path: Path, seed=0xC0FFEE, cases=2000):
     for _ in range(cases):
         a = rand_signed_str()
         b = rand_signed_str()
-        op = random.choice(["add", "sub", "mul", "div", "mod", "cmp"])
-        if op in ("div", "mod") and b == "0":
+        op = random.choice(["add", "sub", "mul", "div", "mod", "cmp", "sqr", "divmod", "divmod_into"])
+        if op in ("div", "mod", "divmod", "divmod_into") and b == "0":
             b = "1"
         lines.append(f"S {op} {a} {b}")
         refs.append(("S", op, a, b))
@@ -205,6 +316,12 @@ def test_random(cli_path: Path, seed=0xC0FFEE, cases=2000):
                     expected = aa // bb
                 elif op == "mod":
                     expected = aa % bb
+                elif op == "sqr":
+                    expected = aa * aa
+                elif op == "pmul":
+                    expected = aa * bb * bb
+                elif op in ("divmod", "divmod_into"):
+                    expected = f"{aa // bb} {aa % bb}"
                 else:
                     expected = -1 if aa < bb else (0 if aa == bb else 1)
             else:
@@ -218,6 +335,10 @@ def test_random(cli_path: Path, seed=0xC0FFEE, cases=2000):
                     expected = cxx_div_trunc(aa, bb)
                 elif op == "mod":
                     expected = cxx_mod(aa, bb)
+                elif op == "sqr":
+                    expected = aa * aa
+                elif op in ("divmod", "divmod_into"):
+                    expected = f"{cxx_div_trunc(aa, bb)} {cxx_mod(aa, bb)}"
                 else:
                     expected = -1 if aa < bb else (0 if aa == bb else 1)
             if str(expected) != res:
@@ -236,10 +357,709 @@ def test_random(cli_path: Path, seed=0xC0FFEE, cases=2000):
     return mismatches
 
 
+def rand_sized_str(max_digits):
+    digits = int(10 ** random.uniform(0, max_digits.bit_length() * 0.30103))
+    digits = max(1, min(digits, max_digits))
+    return str(random.randint(10 ** (digits - 1), 10 ** digits - 1))
+
+
+def test_random_large(cli_path: Path, seed=0xBEEF, cases=240, max_digits=40000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for _ in range(cases):
+        op = random.choice(["mul", "sqr", "pmul", "div", "mod", "divmod"])
+        a = rand_sized_str(max_digits)
+        b = rand_sized_str(max_digits)
+        if op != "sqr" and random.random() < 0.25:
+            b = rand_sized_str(max(1, len(a) // 16))
+        if op in ("div", "mod", "divmod") and len(a) < len(b):
+            a, b = b, a
+        lines.append(f"U {op} {a} {b}")
+        refs.append((op, int(a), int(b)))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (op, aa, bb) in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc:
+            print(f"[ERR] [{cli_path.name}] large line {i}: U {op} ({len(str(aa))} x {len(str(bb))} digits) => {exc[:120]}")
+            mismatches += 1
+            continue
+        if op == "mul":
+            expected = aa * bb
+        elif op == "sqr":
+            expected = aa * aa
+        elif op == "pmul":
+            expected = aa * bb * bb
+        elif op == "div":
+            expected = aa // bb
+        elif op == "divmod":
+            expected = f"{aa // bb} {aa % bb}"
+        else:
+            expected = aa % bb
+        if str(expected) != res:
+            print(f"[MISMATCH][{cli_path.name}] large U {op} ({len(str(aa))} x {len(str(bb))} digits)")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] large random tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] large random tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_division_edges(cli_path: Path, seed=0xD1F, cases=120, max_digits=40000):
+    random.seed(seed)
+    pairs = []
+    for digits in (520, 4000, 16400, max_digits):
+        nines = 10 ** digits - 1
+        pairs += [(nines, 10 ** (digits // 2) - 1), (10 ** (2 * digits) - 1, nines), (10 ** (2 * digits), nines), (nines * nines, nines), (nines * nines - 1, nines), (10 ** (2 * digits), 10 ** digits + 1)]
+    for _ in range(cases):
+        b = int(rand_sized_str(max_digits // 2))
+        q = int(rand_sized_str(max_digits // 2))
+        r = random.choice((0, 1, b - 1, b // 2, random.randrange(b)))
+        pairs.append((q * b + r, b))
+    lines = [f"U divmod {a} {b}" for a, b in pairs]
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (aa, bb) in enumerate(pairs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        expected = f"{aa // bb} {aa % bb}"
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] division line {i}: ({len(str(aa))} x {len(str(bb))} digits) => {(exc or res)[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] division edge tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] division edge tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_random_scalar(cli_path: Path, seed=0x5CA1, cases=1500):
+    random.seed(seed)
+    lines = []
+    refs = []
+    ops = ["adds", "subs", "muls", "divs", "mods", "rsubs", "rdivs", "rmods"]
+    for _ in range(cases):
+        typ = random.choice(["U", "S"])
+        op = random.choice(ops)
+        a = int(rand_bigint_str(random.choice([1, 20, 40, 200])))
+        bits = random.choice([1, 8, 31, 32, 33, 53, 63])
+        b = random.randint(0, 2**bits - 1)
+        if typ == "S":
+            if random.random() < 0.5:
+                a = -a
+            if random.random() < 0.5:
+                b = -b
+            if random.random() < 0.05:
+                b = -(2**63)
+        elif random.random() < 0.05:
+            b = 2**64 - 1
+        if op in ("divs", "mods") and b == 0:
+            b = 7
+        if op in ("rdivs", "rmods") and a == 0:
+            a = 3
+        if typ == "U" and op == "subs" and a < b:
+            a, b = b, a
+        if typ == "U" and op == "rsubs" and b < a:
+            a = a % (b + 1)
+        if op == "adds":
+            expected = a + b
+        elif op == "subs":
+            expected = a - b
+        elif op == "muls":
+            expected = a * b
+        elif op == "divs":
+            expected = cxx_div_trunc(a, b)
+        elif op == "mods":
+            expected = cxx_mod(a, b)
+        elif op == "rsubs":
+            expected = b - a
+        elif op == "rdivs":
+            expected = cxx_div_trunc(b, a)
+        else:
+            expected = cxx_mod(b, a)
+        lines.append(f"{typ} {op} {a} {b}")
+        refs.append(str(expected))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] scalar line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] scalar tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] scalar tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_random_fused(cli_path: Path, seed=0xF05E, cases=400, max_digits=20000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for _ in range(cases):
+        typ = random.choice(["U", "S"])
+        op = random.choice(["fma", "addmul", "submul", "addmul_alias", "fmulmod"])
+        a, b, c = (int(rand_sized_str(max_digits)) for _ in range(3))
+        if random.random() < 0.3:
+            c = int(rand_sized_str(max(1, len(str(b)) // 16)))
+        if random.random() < 0.3:
+            a = int("9" * random.randint(len(str(b)) + len(str(c)) - 1, len(str(b)) + len(str(c)) + 20))
+        if typ == "S":
+            a, b, c = (x if random.random() < 0.5 else -x for x in (a, b, c))
+        if op == "fma":
+            expected = a * b + c
+        elif op == "addmul":
+            expected = a + b * c
+        elif op == "submul":
+            if typ == "U" and a < b * c:
+                a += b * c
+            expected = a - b * c
+        elif op == "addmul_alias":
+            expected = a + a * b
+        else:
+            c = abs(c) or 1
+            expected = a * b % c
+        lines.append(f"{typ} {op} {a} {b}" + ("" if op == "addmul_alias" else f" {c}"))
+        refs.append(str(expected))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] fused line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] fused tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] fused tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_parallel(cli_path: Path, seed=0x7EAD, cases=6):
+    random.seed(seed)
+    lines = []
+    def digits(count):
+        return random.choice("123456789") + "".join(random.choices(string.digits, k=count - 1))
+
+    for i in range(cases):
+        a = "9" * 400000 if i == 0 else digits(random.randint(300000, 600000))
+        b = a if i == 0 else digits(random.randint(300000, 600000) if i % 2 else random.randint(20000, 40000))
+        lines += [f"U mul_parallel {a} {b}", f"U mul {a} {b}", f"U sqr {a}", f"U mul_threads {a} {b}"]
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i in range(cases):
+        results = [expect_ok(out[4 * i + j]) if 4 * i + j < len(out) else (None, "missing output") for j in range(4)]
+        if any(exc for _, exc in results) or results[0][0] != f"{results[1][0]} {results[2][0]}" or results[3][0] != results[1][0]:
+            print(f"[MISMATCH][{cli_path.name}] parallel case {i}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] parallel tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] parallel tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_batch(cli_path: Path, seed=0xBA7C, cases=40, max_digits=8000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for _ in range(cases):
+        a, b = int(rand_sized_str(max_digits)), int(rand_sized_str(max_digits))
+        lines.append(f"U mul_batch {a} {b}")
+        refs.append(f"{(a + 1) * b} 1")
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] batch line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] batch tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] batch tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_stream(cli_path: Path, seed=0x57EA, cases=200, max_digits=20000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for a in ("0", "00000000", "000000001", "1" + "0" * 15, "9" * 17):
+        lines += [f"U stream {a}", f"S stream -{a}", f"U stream +{a}", f"S stream +{a}"]
+        refs += [f"{int(a)} 1", f"{-int(a)} 1", f"{int(a)} 1", f"{int(a)} 1"]
+    for kind, a in (("U", "-5"), ("U", "+"), ("U", "++5"), ("S", "--5"), ("S", "-+5"), ("S", "+-5"), ("S", "-")):
+        lines.append(f"{kind} stream {a}")
+        refs.append("0 0")
+    for i in range(cases):
+        a = "0" * random.randint(0, 9) + rand_sized_str(max_digits if i % 4 == 0 else 40)
+        n = int(a)
+        lines.append(f"U stream {a}")
+        refs.append(f"{n} 1")
+        lines.append(f"S stream -{a}")
+        refs.append(f"{-n} 1")
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] stream line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] stream tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] stream tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_serialize(cli_path: Path, seed=0x5E71, cases=120, max_digits=20000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for a, b in (("0", "0"), ("0", "5"), ("100000000", "99999999"), ("0000000012345678", "12345678")):
+        lines.append(f"U serialize {a} {b}")
+        x, y = int(a), int(b)
+        refs.append(f"{x} {x + y} {x * y} {(x > y) - (x < y)}")
+    for a in ("0", "-0", "-100000000", "12345678901234567890"):
+        lines.append(f"S serialize {a}")
+        refs.append(str(int(a)))
+    for _ in range(cases):
+        a, b = rand_sized_str(max_digits), rand_sized_str(max_digits)
+        x, y = int(a), int(b)
+        lines.append(f"U serialize {a} {b}")
+        refs.append(f"{x} {x + y} {x * y} {(x > y) - (x < y)}")
+        lines.append(f"S serialize -{a}")
+        refs.append(str(-x))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] serialize line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] serialize tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] serialize tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def int_root(n, k):
+    if n < 2:
+        return n
+    x = 1 << -(-n.bit_length() // k)
+    while True:
+        y = ((k - 1) * x + n // x ** (k - 1)) // k
+        if y >= x:
+            return x
+        x = y
+
+
+def test_roots(cli_path: Path, seed=0x5087, cases=150, max_digits=60000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    values = ["0", "1", "2", "3", "4", "99999999", "100000000", "9999999999999999", "10000000000000000", str(10 ** 80 - 1), str((10 ** 40 + 7) ** 2)]
+    values += [rand_sized_str(max_digits) for _ in range(cases)]
+    values += [str(int(rand_sized_str(max_digits // 2)) ** 2) for _ in range(cases // 3)]
+    for a in values:
+        x = int(a)
+        s = math.isqrt(x)
+        lines.append(f"U sqrtrem {a}")
+        refs.append(f"{s} {x - s * s} 1")
+        lines.append(f"U is_square {a}")
+        refs.append("1" if s * s == x else "0")
+    for a in values[:cases // 2]:
+        k = random.choice((1, 2, 3, 4, 5, 7, 16, 101))
+        lines.append(f"U root {a} {k}")
+        refs.append(str(int_root(int(a), k)))
+    lines.append(f"U root {3 ** 4000} 4000")
+    refs.append("3")
+    for a, k, r in (("10", 1000000000, 1), (str(2 ** 200 - 1), 200, 1), (str(2 ** 200), 200, 2), (str(10 ** 50), 167, 1), (str(10 ** 50), 166, 2)):
+        lines.append(f"U root {a} {k}")
+        refs.append(str(r))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] roots line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] roots tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] roots tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_gcd(cli_path: Path, seed=0x6CD, cases=120, max_digits=30000):
+    random.seed(seed)
+    pairs = [("0", "0"), ("0", "7"), ("12", "0"), ("1", "1"), ("99999999", "99999999"), ("100000000", "1"), (str(2 ** 300), str(3 ** 200)), (str(10 ** 5000 + 1), "37")]
+    for _ in range(cases):
+        common = int(rand_sized_str(max_digits // 4))
+        pairs.append((str(int(rand_sized_str(max_digits)) * common), str(int(rand_sized_str(max_digits)) * common)))
+    fib = [1, 1]
+    for _ in range(20000):
+        fib.append(fib[-1] + fib[-2])
+    pairs.append((str(fib[-1]), str(fib[-2])))
+    signed = [(("-" if random.random() < 0.5 else "") + a, ("-" if random.random() < 0.5 else "") + b) for a, b in pairs[:cases // 2]]
+    lines = [f"U gcd {a} {b}" for a, b in pairs] + [f"S gcd {a} {b}" for a, b in signed]
+    inverses = [(a, b) for a, b in pairs + [(str(int(rand_sized_str(max_digits))), str(int(rand_sized_str(max_digits)) | 1)) for _ in range(cases // 4)] if int(b) > 0]
+    lines += [f"U modinv {a} {b}" for a, b in inverses]
+    signed_inverses = [(a, b.lstrip("-")) for a, b in signed if b.lstrip("-") != "0"]
+    lines += [f"S modinv {a} {b}" for a, b in signed_inverses]
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (a, b) in enumerate(pairs + signed):
+        x, y = int(a), int(b)
+        g = math.gcd(x, y)
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        fields = res.split() if res else []
+        ok = not exc and len(fields) == 5 and int(fields[0]) == g and int(fields[1]) * x + int(fields[2]) * y == g and fields[4] == "1"
+        ok = ok and int(fields[3]) == (abs(x * y) // g if g else 0) and abs(int(fields[1])) <= max(1, abs(y)) and abs(int(fields[2])) <= max(1, abs(x))
+        if not ok:
+            print(f"[MISMATCH][{cli_path.name}] gcd line {i}: {lines[i][:80]} => {(exc or res)[:60]}")
+            mismatches += 1
+    for j, (a, b) in enumerate(inverses + signed_inverses):
+        i = len(pairs) + len(signed) + j
+        x, m = int(a), int(b)
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        expected = str(pow(x, -1, m)) if math.gcd(x, m) == 1 else None
+        if (expected is None and exc is None) or (expected is not None and res != expected):
+            print(f"[MISMATCH][{cli_path.name}] modinv line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {(expected or 'EXC')[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] gcd tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] gcd tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_moves(cli_path: Path, seed=0x3F0E, cases=150, max_digits=20000):
+    random.seed(seed)
+    pairs = [("0", "0"), ("1", "1"), ("100000000", "1"), ("99999999", "99999999"), (str(10 ** 800), str(10 ** 800 - 1))]
+    for _ in range(cases):
+        pairs.append(tuple(sorted((int(rand_sized_str(max_digits)), int(rand_sized_str(max_digits))), reverse=True)))
+    signed = [("-1", "1"), ("5", "-5"), (str(-10 ** 800), str(10 ** 800 - 1))]
+    for _ in range(cases):
+        signed.append(tuple(random.choice(("", "-")) + rand_sized_str(max_digits) for _ in range(2)))
+    lines = [f"U moves {a} {b}" for a, b in pairs] + [f"S moves {a} {b}" for a, b in signed]
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (a, b) in enumerate(pairs + signed):
+        x, y = int(a), int(b)
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        expected = f"{x + y} {x - y} 1"
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] moves line {i}: {lines[i][:80]} => {(exc or res)[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] moves tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] moves tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_decimal(cli_path: Path, seed=0xDEC, cases=200, max_digits=20000):
+    random.seed(seed)
+    values = ["0", "1", "9", "10", "99999999", "100000000", "12345678", str(10 ** 80), str(10 ** 80 - 1), "-1", "-100000000", str(-10 ** 41 - 7)]
+    values += [random.choice(("", "-")) + rand_sized_str(max_digits) for _ in range(cases)]
+    items = []
+    for a in values:
+        for k in (0, 1, 7, 8, 9, 16, 23, len(a.lstrip("-")) - 1, len(a.lstrip("-")) + 3, random.randint(0, 3 * len(a))):
+            items.append((random.choice("US") if not a.startswith("-") else "S", a, max(k, 0)))
+    lines = [f"{t} decimal {a} {k}" for t, a, k in items]
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (t, a, k) in enumerate(items):
+        x = int(a)
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        expected = f"{x * 10 ** k} {cxx_div_trunc(x, 10 ** k)} {cxx_mod(x, 10 ** k)} {len(str(abs(x)))} {abs(x) // 10 ** k % 10}"
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] decimal line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] decimal tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] decimal tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_products(cli_path: Path, seed=0xFAC7, cases=60, max_n=20000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for n in list(range(0, 40)) + [random.randint(40, max_n) for _ in range(cases)]:
+        lines.append(f"U factorial {n}")
+        refs.append(str(math.factorial(n)))
+    for n, k in [(0, 0), (5, 7), (10, 3), (4294967295, 2), (4294967295, 4294967294)] + [(n, random.randint(0, n + 2)) for n in (random.randint(0, max_n) for _ in range(cases))]:
+        lines.append(f"U binomial {n} {k}")
+        refs.append(str(math.comb(n, k)))
+    for a, b in [(1, 0), (0, 5), (7, 7), (1, 2000)] + [tuple(sorted((random.randint(1, max_n), random.randint(1, max_n)))) for _ in range(cases // 4)]:
+        lines.append(f"U product {a} {b}")
+        refs.append(f"{math.prod(range(a, b + 1))} 1")
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] products line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] products tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] products tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_fixed(cli_path: Path, seed=0xF1ED, cases=400, max_digits=512):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for a, b in (("0", "1"), ("99999999", "1"), ("100000000", "99999999"), ("0000000000000000000123", "7"), ("9" * 512, "9" * 512), ("1" + "0" * 511, "1" + "0" * 256)):
+        lines.append(f"U fixed {a} {b}")
+        x, y = int(a), int(b)
+        refs.append(f"{x + y} {x * y} {x // y} {x % y} {x * x} 1")
+    for _ in range(cases):
+        a, b = rand_sized_str(max_digits), rand_sized_str(max_digits)
+        x, y = int(a), int(b)
+        if y == 0:
+            continue
+        lines.append(f"U fixed {a} {b}")
+        refs.append(f"{x + y} {x * y} {x // y} {x % y} {x * x} 1")
+        sx, sy = random.choice((1, -1)) * x, random.choice((1, -1)) * y
+        lines.append(f"S fixed {sx} {sy}")
+        refs.append(f"{sx + sy} {sx * sy} {cxx_div_trunc(sx, sy)} {cxx_mod(sx, sy)} {sx * sx} 1")
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] fixed line {i}: {lines[i][:80]} => {(exc or res)[:60]} vs {expected[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] fixed tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] fixed tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_profile(cli_path: Path, seed=0x9F0F):
+    # Limb counts chosen for INTEGER_TRANSFORM_LIMIT=64: schoolbook, FFT, then NTT with Newton division.
+    random.seed(seed)
+    shapes = (
+        (10, 6, ("bruteforce_multiply", "bruteforce_division")),
+        (50, 40, ("transform_multiply", "bruteforce_division")),
+        (150, 75, ("modular_transform_multiply", "newton_division", "newton_inverse", "division_correction")),
+    )
+    lines = []
+    refs = []
+    for first, second, tiers in shapes:
+        a, b = str(random.randint(10 ** (first * 8 - 1), 10 ** (first * 8) - 1)), str(random.randint(10 ** (second * 8 - 1), 10 ** (second * 8) - 1))
+        lines.append(f"U profile {a} {b}")
+        refs.append((int(a) * int(b), int(a) // int(b), tiers))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (product, quotient, tiers) in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        fields = (res or "").split()
+        counters = {fields[j]: (int(fields[j + 1]), int(fields[j + 2])) for j in range(3, len(fields) - 2, 3)}
+        ok = not exc and fields[:3] == [str(product), str(quotient), "1"] and all(counters.get(name, (0, 0))[0] > 0 and counters[name][1] > 0 for name in tiers) and counters.get("allocations", (0, 0))[0] > 0
+        if not ok:
+            print(f"[MISMATCH][{cli_path.name}] profile line {i}: {(exc or res)[-200:]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] profile tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] profile tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+def test_random_barrett(cli_path: Path, seed=0xBA55, cases=300, max_digits=3000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for _ in range(cases):
+        op = random.choice(["bred", "mulmod", "powmod", "spowmod", "pow"])
+        m = rand_sized_str(max_digits)
+        if m == "0":
+            m = "1"
+        if op == "bred":
+            a = rand_sized_str(random.choice([len(m), 2 * len(m), 3 * len(m)]))
+            lines.append(f"U bred {a} {m}")
+            refs.append((op, int(a), None, int(m)))
+        elif op == "mulmod":
+            a = rand_sized_str(len(m) + 8)
+            b = rand_sized_str(len(m) + 8)
+            lines.append(f"U mulmod {a} {b} {m}")
+            refs.append((op, int(a), int(b), int(m)))
+        elif op == "pow":
+            a = rand_sized_str(max(1, len(m) // 8))
+            e = str(random.randint(0, 64))
+            typ = random.choice(["U", "S"])
+            if typ == "S" and random.random() < 0.5:
+                a = "-" + a
+            lines.append(f"{typ} pow {a} {e}")
+            refs.append((op, int(a), int(e), None))
+        else:
+            a = rand_sized_str(len(m) + 8)
+            e = rand_sized_str(random.choice([4, 40, 300]))
+            if op == "spowmod":
+                a = "-" + a
+                lines.append(f"S spowmod {a} {e} {m}")
+            else:
+                lines.append(f"U powmod {a} {e} {m}")
+            refs.append((op, int(a), int(e), int(m)))
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, (op, aa, bb, mm) in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc:
+            print(f"[ERR] [{cli_path.name}] barrett line {i}: {op} ({len(str(aa))} digits) => {exc[:120]}")
+            mismatches += 1
+            continue
+        if op == "bred":
+            expected = aa % mm
+        elif op == "mulmod":
+            expected = aa * bb % mm
+        elif op == "pow":
+            expected = aa**bb
+        else:
+            expected = pow(aa, bb, mm)
+        if str(expected) != res:
+            print(f"[MISMATCH][{cli_path.name}] barrett {op} ({len(str(aa))} digits)")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] barrett tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] barrett tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
+RADIX_DIGITS = "0123456789abcdefghijklmnopqrstuvwxyz"
+
+
+def int_to_radix(n, radix, width=0):
+    if n.bit_length() <= 512:
+        s = ""
+        while n:
+            n, d = divmod(n, radix)
+            s = RADIX_DIGITS[d] + s
+        return s.rjust(width, "0") if width else (s or "0")
+    half = 1
+    while radix ** (2 * half) <= n:
+        half *= 2
+    q, r = divmod(n, radix**half)
+    return int_to_radix(q, radix, width - half if width else 0) + int_to_radix(r, radix, half)
+
+
+def test_random_radix(cli_path: Path, seed=0x7AD1, cases=200, max_digits=20000):
+    random.seed(seed)
+    lines = []
+    refs = []
+    for _ in range(cases):
+        a = rand_sized_str(max_digits)
+        radix = random.choice([2, 3, 7, 16, 35, 36])
+        n = int(a)
+        text = int_to_radix(n, radix)
+        lines.append(f"U to_radix {a} {radix}")
+        refs.append(text)
+        lines.append(f"U from_radix {'0' * random.randint(0, 3)}{text.upper() if random.random() < 0.3 else text} {radix}")
+        refs.append(a.lstrip("0") or "0")
+        lines.append(f"S to_radix -{a} {radix}")
+        refs.append("-" + text if n else "0")
+        raw = n.to_bytes(max(1, (n.bit_length() + 7) // 8), "big").hex()
+        lines.append(f"U to_bytes {a}")
+        refs.append(raw)
+        lines.append(f"U from_bytes 00{raw}")
+        refs.append(a.lstrip("0") or "0")
+
+    rc, out, err = run_cli(cli_path, lines)
+    assert rc == 0, f"CLI exited {rc}, stderr={err}"
+
+    mismatches = 0
+    for i, expected in enumerate(refs):
+        res, exc = expect_ok(out[i]) if i < len(out) else (None, "missing output")
+        if exc or res != expected:
+            print(f"[MISMATCH][{cli_path.name}] radix line {i}: {lines[i][:60]}... => {(exc or res)[:60]}")
+            mismatches += 1
+
+    if mismatches == 0:
+        print(f"[OK] radix tests passed on {cli_path.name}")
+    else:
+        print(f"[WARN] radix tests mismatches on {cli_path.name}: {mismatches}")
+    return mismatches
+
+
 def main():
     build_all()
 
-    for cli in (CLI_SIMD, CLI_FALLBACK):
+    for cli in (CLI_SIMD, CLI_FALLBACK, CLI_MODULAR, CLI_MODULAR_FALLBACK) + ((CLI_AVX2,) if X86_HOST else ()):
         rc, out, err = run_cli(cli, ["U add 1 2"])
         if rc != 0:
             print(f"[CLI-ERR] {cli.name}", err)
@@ -249,11 +1069,14 @@ def main():
     test_deterministic(CLI_SIMD)
     test_deterministic(CLI_FALLBACK)
 
-    m_simd = test_random(CLI_SIMD)
-    m_fallback = test_random(CLI_FALLBACK)
+    m_simd = test_random(CLI_SIMD) + test_random_scalar(CLI_SIMD) + test_random_fused(CLI_SIMD) + test_parallel(CLI_SIMD) + test_batch(CLI_SIMD) + test_random_large(CLI_SIMD) + test_division_edges(CLI_SIMD) + test_random_barrett(CLI_SIMD) + test_random_radix(CLI_SIMD) + test_stream(CLI_SIMD) + test_serialize(CLI_SIMD) + test_fixed(CLI_SIMD) + test_roots(CLI_SIMD) + test_gcd(CLI_SIMD) + test_products(CLI_SIMD) + test_moves(CLI_SIMD) + test_decimal(CLI_SIMD)
+    m_fallback = test_random(CLI_FALLBACK) + test_random_scalar(CLI_FALLBACK) + test_random_fused(CLI_FALLBACK) + test_parallel(CLI_FALLBACK) + test_batch(CLI_FALLBACK) + test_random_large(CLI_FALLBACK) + test_division_edges(CLI_FALLBACK) + test_random_barrett(CLI_FALLBACK) + test_random_radix(CLI_FALLBACK) + test_stream(CLI_FALLBACK) + test_serialize(CLI_FALLBACK) + test_fixed(CLI_FALLBACK) + test_roots(CLI_FALLBACK) + test_gcd(CLI_FALLBACK) + test_products(CLI_FALLBACK) + test_moves(CLI_FALLBACK) + test_decimal(CLI_FALLBACK)
+    if X86_HOST:
+        m_simd += test_random(CLI_AVX2) + test_parallel(CLI_AVX2) + test_random_large(CLI_AVX2)
+    m_modular = test_random_fused(CLI_MODULAR) + test_random_large(CLI_MODULAR) + test_division_edges(CLI_MODULAR) + test_random_large(CLI_MODULAR_FALLBACK) + test_random_barrett(CLI_MODULAR) + test_random_radix(CLI_MODULAR) + test_profile(CLI_MODULAR) + test_roots(CLI_MODULAR) + test_gcd(CLI_MODULAR)
 
-    if m_simd or m_fallback:
-        print(f"[SUMMARY] mismatches: SIMD={m_simd}, fallback={m_fallback}")
+    if m_simd or m_fallback or m_modular:
+        print(f"[SUMMARY] mismatches: SIMD={m_simd}, fallback={m_fallback}, modular={m_modular}")
         sys.exit(2)
 
     print("[DONE] all tests passed with ASan+UBSan on both SIMD and fallback")